@@ -0,0 +1,89 @@
+/*
+ Copyright (C) 2021 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "FloatType.h"
+#include "Model/BrushGeometry.h"
+#include "Model/Polyhedron.h"
+
+#include <vecmath/bbox.h>
+#include <vecmath/constants.h>
+#include <vecmath/plane.h>
+#include <vecmath/vec.h>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "../../test/src/Catch2.h"
+#include "BenchmarkUtils.h"
+
+namespace TrenchBroom {
+namespace Model {
+static constexpr size_t NumRepetitions = 1000;
+
+/**
+ * Returns the tangent planes of a sphere at points that are evenly distributed on a spiral, which
+ * yields a closed convex polyhedron with the given number of faces.
+ */
+static std::vector<vm::plane3> makeSpherePlanes(const size_t numPlanes, const FloatType radius) {
+  auto result = std::vector<vm::plane3>{};
+  const auto goldenAngle = vm::C::pi() * (3.0 - std::sqrt(5.0));
+  for (size_t i = 0; i < numPlanes; ++i) {
+    const auto z = 1.0 - 2.0 * (static_cast<FloatType>(i) + 0.5) / static_cast<FloatType>(numPlanes);
+    const auto r = std::sqrt(1.0 - z * z);
+    const auto angle = goldenAngle * static_cast<FloatType>(i);
+    const auto normal = vm::vec3(r * std::cos(angle), r * std::sin(angle), z);
+    result.emplace_back(radius, normal);
+  }
+  return result;
+}
+
+TEST_CASE("BrushGeometryBenchmark.intersectPlanesVsClip", "[BrushGeometryBenchmark]") {
+  const auto worldBounds = vm::bbox3(8192.0);
+
+  // Brush::updateGeometryFromFaces intersects the face planes of brushes with few faces and clips
+  // the others, compare both for increasing face counts to find where clipping becomes faster
+  for (const size_t numPlanes : {6u, 8u, 10u, 12u, 14u, 15u, 16u, 18u, 20u, 24u, 32u}) {
+    const auto planes = makeSpherePlanes(numPlanes, 256.0);
+
+    timeLambda(
+      [&]() {
+        for (size_t i = 0; i < NumRepetitions; ++i) {
+          auto faces = std::vector<BrushFaceGeometry*>{};
+          CHECK(BrushGeometry::fromPlanes(planes, worldBounds, faces));
+        }
+      },
+      "intersect " + std::to_string(numPlanes) + " planes " + std::to_string(NumRepetitions)
+        + " times");
+
+    timeLambda(
+      [&]() {
+        for (size_t i = 0; i < NumRepetitions; ++i) {
+          auto geometry = BrushGeometry(worldBounds);
+          for (const auto& plane : planes) {
+            geometry.clip(plane);
+          }
+          CHECK(geometry.closed());
+        }
+      },
+      "clip " + std::to_string(numPlanes) + " planes " + std::to_string(NumRepetitions) + " times");
+  }
+}
+} // namespace Model
+} // namespace TrenchBroom
@@ -0,0 +1,118 @@
+/*
+ Copyright (C) 2021 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "Model/Brush.h"
+#include "Model/BrushBuilder.h"
+#include "Model/BrushError.h"
+#include "Model/MapFormat.h"
+
+#include <kdl/result.h>
+
+#include <vecmath/bbox.h>
+#include <vecmath/vec.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "../../test/src/Catch2.h"
+#include "BenchmarkUtils.h"
+
+namespace TrenchBroom {
+namespace Model {
+static constexpr size_t NumRepetitions = 100;
+
+namespace {
+struct SubtractCase {
+  std::string name;
+  Brush minuend;
+  std::vector<Brush> subtrahends;
+};
+} // namespace
+
+static std::vector<SubtractCase> makeSubtractCases(const BrushBuilder& builder) {
+  auto result = std::vector<SubtractCase>{};
+
+  result.push_back(
+    {"cube minus corner cube",
+     builder.createCube(64.0, "").value(),
+     {builder.createCuboid(vm::bbox3(vm::vec3(16, 16, 16), vm::vec3(64, 64, 64)), "").value()}});
+
+  result.push_back(
+    {"cube minus centered beam",
+     builder.createCube(64.0, "").value(),
+     {builder.createCuboid(vm::bbox3(vm::vec3(-8, -8, -64), vm::vec3(8, 8, 64)), "").value()}});
+
+  result.push_back(
+    {"cube minus two overlapping cubes",
+     builder.createCube(64.0, "").value(),
+     {builder.createCuboid(vm::bbox3(vm::vec3(-48, -16, -16), vm::vec3(0, 16, 16)), "").value(),
+      builder.createCuboid(vm::bbox3(vm::vec3(-16, -48, -16), vm::vec3(16, 0, 16)), "").value()}});
+
+  result.push_back(
+    {"slab minus row of pillars",
+     builder.createCuboid(vm::bbox3(vm::vec3(-128, -32, -8), vm::vec3(128, 32, 8)), "").value(),
+     {builder.createCuboid(vm::bbox3(vm::vec3(-96, -8, -16), vm::vec3(-80, 8, 16)), "").value(),
+      builder.createCuboid(vm::bbox3(vm::vec3(-32, -8, -16), vm::vec3(-16, 8, 16)), "").value(),
+      builder.createCuboid(vm::bbox3(vm::vec3(16, -8, -16), vm::vec3(32, 8, 16)), "").value(),
+      builder.createCuboid(vm::bbox3(vm::vec3(80, -8, -16), vm::vec3(96, 8, 16)), "").value()}});
+
+  return result;
+}
+
+static size_t countFragments(
+  const SubtractCase& subtractCase, const vm::bbox3& worldBounds, const bool mergeFragments) {
+  auto subtrahends = std::vector<const Brush*>{};
+  for (const auto& subtrahend : subtractCase.subtrahends) {
+    subtrahends.push_back(&subtrahend);
+  }
+
+  return subtractCase.minuend
+    .subtract(MapFormat::Standard, worldBounds, "", subtrahends, mergeFragments)
+    .size();
+}
+
+TEST_CASE("BrushSubtractBenchmark.subtractWithAndWithoutMerging", "[BrushSubtractBenchmark]") {
+  const auto worldBounds = vm::bbox3(4096.0);
+  const auto builder = BrushBuilder(MapFormat::Standard, worldBounds);
+  const auto subtractCases = makeSubtractCases(builder);
+
+  for (const auto& subtractCase : subtractCases) {
+    printf(
+      "'%s': %zu fragments unmerged, %zu fragments merged\n", subtractCase.name.c_str(),
+      countFragments(subtractCase, worldBounds, false),
+      countFragments(subtractCase, worldBounds, true));
+  }
+
+  for (const auto mergeFragments : {false, true}) {
+    timeLambda(
+      [&]() {
+        for (size_t i = 0; i < NumRepetitions; ++i) {
+          for (const auto& subtractCase : subtractCases) {
+            countFragments(subtractCase, worldBounds, mergeFragments);
+          }
+        }
+      },
+      "subtract " + std::to_string(NumRepetitions) + " times "
+        + (mergeFragments ? "with" : "without") + " merging fragments");
+  }
+}
+} // namespace Model
+} // namespace TrenchBroom
@@ -0,0 +1,105 @@
+/*
+ Copyright (C) 2021 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "Model/Brush.h"
+#include "Model/BrushBuilder.h"
+#include "Model/BrushError.h"
+#include "Model/MapFormat.h"
+
+#include <kdl/result.h>
+
+#include <vecmath/bbox.h>
+#include <vecmath/constants.h>
+#include <vecmath/vec.h>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "../../test/src/Catch2.h"
+#include "BenchmarkUtils.h"
+
+namespace TrenchBroom {
+namespace Model {
+static constexpr size_t NumSides = 64;
+static constexpr size_t NumDragSteps = 100;
+
+static std::vector<vm::vec3> makeCylinderPoints(const size_t numSides, const FloatType radius) {
+  auto result = std::vector<vm::vec3>{};
+  for (size_t i = 0; i < numSides; ++i) {
+    const auto angle =
+      static_cast<FloatType>(i) * vm::C::two_pi() / static_cast<FloatType>(numSides);
+    const auto x = std::round(radius * std::cos(angle));
+    const auto y = std::round(radius * std::sin(angle));
+    result.emplace_back(x, y, -radius);
+    result.emplace_back(x, y, +radius);
+  }
+  return result;
+}
+
+TEST_CASE("BrushVertexMoveBenchmark.dragCylinderVertices", "[BrushVertexMoveBenchmark]") {
+  const auto worldBounds = vm::bbox3(8192.0);
+  const auto builder = BrushBuilder(MapFormat::Standard, worldBounds);
+  const auto points = makeCylinderPoints(NumSides, 1024.0);
+  const auto cylinder = builder.createBrush(points, "").value();
+
+  // drag a single vertex outwards in small steps, validating each step like the vertex tool does
+  timeLambda(
+    [&]() {
+      auto brush = cylinder;
+      auto vertexPosition = points.front();
+      const auto delta = vm::vec3(1, 0, 1);
+      for (size_t i = 0; i < NumDragSteps; ++i) {
+        const auto vertexPositions = std::vector<vm::vec3>{vertexPosition};
+        if (brush.canMoveVertices(worldBounds, vertexPositions, delta)) {
+          CHECK(brush.moveVertices(worldBounds, vertexPositions, delta).is_success());
+          vertexPosition = vertexPosition + delta;
+        }
+      }
+    },
+    "drag one vertex of a " + std::to_string(NumSides) + " sided cylinder "
+      + std::to_string(NumDragSteps) + " times");
+
+  // drag the top cap upwards
+  timeLambda(
+    [&]() {
+      auto brush = cylinder;
+      auto vertexPositions = std::vector<vm::vec3>{};
+      for (const auto& point : points) {
+        if (point.z() > 0.0) {
+          vertexPositions.push_back(point);
+        }
+      }
+
+      const auto delta = vm::vec3(0, 0, 1);
+      for (size_t i = 0; i < NumDragSteps; ++i) {
+        if (brush.canMoveVertices(worldBounds, vertexPositions, delta)) {
+          CHECK(brush.moveVertices(worldBounds, vertexPositions, delta).is_success());
+          for (auto& vertexPosition : vertexPositions) {
+            vertexPosition = vertexPosition + delta;
+          }
+        }
+      }
+    },
+    "drag the top cap of a " + std::to_string(NumSides) + " sided cylinder "
+      + std::to_string(NumDragSteps) + " times");
+}
+} // namespace Model
+} // namespace TrenchBroom
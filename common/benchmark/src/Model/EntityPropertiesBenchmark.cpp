@@ -0,0 +1,125 @@
+/*
+ Copyright (C) 2021 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Model/EntityProperties.h"
+
+#include <algorithm>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../test/src/Catch2.h"
+#include "BenchmarkUtils.h"
+
+namespace TrenchBroom {
+namespace Model {
+static constexpr size_t NumLookups = 10000000;
+
+static std::vector<EntityProperty> makeProperties() {
+  return {
+    {EntityPropertyKeys::Classname, "light"},
+    {EntityPropertyKeys::Origin, "0 0 0"},
+    {EntityPropertyKeys::Angle, "90"},
+    {EntityPropertyKeys::Spawnflags, "1"},
+    {EntityPropertyKeys::Targetname, "lamp"},
+    {EntityPropertyKeys::Target, "door"},
+    {"light", "300"},
+    {"_color", "1 0.5 0.5"},
+    {"wait", "2"},
+    {"style", "11"},
+  };
+}
+
+template <typename Find> static size_t lookUp(const std::string& key, const Find& find) {
+  auto result = size_t(0);
+  for (size_t i = 0; i < NumLookups; ++i) {
+    result += find(key).size();
+  }
+  return result;
+}
+
+TEST_CASE("EntityPropertiesBenchmark.findProperty", "[EntityPropertiesBenchmark]") {
+  const auto properties = makeProperties();
+  const auto lightKey = std::string{"light"};
+  const auto missingKey = std::string{"delay"};
+
+  const auto findByMatcher = [&](const std::string& key) -> const std::string& {
+    return findProperty(properties, key);
+  };
+
+  // the lookup that was used before property keys were interned
+  const auto findByString = [&](const std::string& key) -> const std::string& {
+    const auto it = std::find_if(properties.begin(), properties.end(), [&](const auto& property) {
+      return property.key() == key;
+    });
+    return it != properties.end() ? it->value() : EntityPropertyValues::DefaultValue;
+  };
+
+  auto sink = size_t(0);
+  for (const auto* key : {&EntityPropertyKeys::Classname, &EntityPropertyKeys::Target}) {
+    timeLambda(
+      [&]() {
+        sink += lookUp(*key, findByMatcher);
+      },
+      "find well-known key " + *key + " " + std::to_string(NumLookups) + " times");
+    timeLambda(
+      [&]() {
+        sink += lookUp(*key, findByString);
+      },
+      "find well-known key " + *key + " by string comparison " + std::to_string(NumLookups)
+        + " times");
+  }
+
+  for (const auto* key : {&lightKey, &missingKey}) {
+    timeLambda(
+      [&]() {
+        sink += lookUp(*key, findByMatcher);
+      },
+      "find other key " + *key + " " + std::to_string(NumLookups) + " times");
+    timeLambda(
+      [&]() {
+        sink += lookUp(*key, findByString);
+      },
+      "find other key " + *key + " by string comparison " + std::to_string(NumLookups)
+        + " times");
+  }
+
+  // issue generators look up properties from many threads at once
+  const auto numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+  timeLambda(
+    [&]() {
+      auto futures = std::vector<std::future<size_t>>{};
+      for (unsigned int i = 0; i < numThreads; ++i) {
+        futures.push_back(std::async(std::launch::async, [&]() {
+          return lookUp(EntityPropertyKeys::Origin, findByMatcher)
+                 + lookUp(lightKey, findByMatcher);
+        }));
+      }
+      for (auto& future : futures) {
+        sink += future.get();
+      }
+    },
+    "find well-known and other keys " + std::to_string(NumLookups) + " times on "
+      + std::to_string(numThreads) + " threads");
+
+  CHECK(sink > 0u);
+}
+} // namespace Model
+} // namespace TrenchBroom
@@ -27,9 +27,12 @@
 #include <vecmath/ray.h>
 #include <vecmath/scalar.h>
 
+#include <algorithm>
 #include <cassert>
 #include <iosfwd>
+#include <iterator>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace TrenchBroom {
@@ -131,6 +134,16 @@ private:
      */
     virtual void accept(Visitor& visitor) const = 0;
 
+    /**
+     * Detaches the leafs of the subtree rooted at `this` and appends them to the given vector. The
+     * inner nodes of the subtree remain connected to each other.
+     *
+     * @param leafs the vector to append the leafs to
+     * @return the node that must be deleted to delete the remaining inner nodes of the subtree, or
+     * nullptr if there are no inner nodes
+     */
+    virtual Node* releaseLeafs(std::vector<LeafNode*>& leafs) = 0;
+
   public:
     /**
      * Appends a textual representation of this node to the given output stream.
@@ -212,6 +225,7 @@ private:
       return this->m_parent->updateAndReturnRoot();
     }
 
+  public: // Node replacement
     /**
      * One of our direct children is being swapped for a new node.
      *
@@ -265,6 +279,18 @@ private:
       return newTreeRoot;
     }
 
+  public: // refitting
+    /**
+     * Recomputes the bounds of this node from the bounds of its children.
+     *
+     * @return true if the bounds of this node have changed
+     */
+    bool refit() {
+      const auto oldBounds = this->bounds();
+      updateBounds();
+      return this->bounds() != oldBounds;
+    }
+
   public: // Node overrides
     ~InnerNode() override {
       delete m_left;
@@ -364,6 +390,12 @@ private:
       }
     }
 
+    Node* releaseLeafs(std::vector<LeafNode*>& leafs) override {
+      m_left = m_left->releaseLeafs(leafs);
+      m_right = m_right->releaseLeafs(leafs);
+      return this;
+    }
+
   public:
     void appendTo(std::ostream& str, const std::string& indent, const size_t level) const override {
       for (size_t i = 0; i < level; ++i)
@@ -421,6 +453,11 @@ private:
      */
     const U& data() const { return m_data; }
 
+    /**
+     * Sets the bounds of this leaf. The caller must refit the ancestors of this leaf afterwards.
+     */
+    using Node::setBounds;
+
   public: // Node overrides
     size_t height() const override { return 1; }
 
@@ -442,6 +479,12 @@ private:
 
     void accept(Visitor& visitor) const override { visitor.visit(this); }
 
+    Node* releaseLeafs(std::vector<LeafNode*>& leafs) override {
+      this->m_parent = nullptr;
+      leafs.push_back(this);
+      return nullptr;
+    }
+
     void appendTo(std::ostream& str, const std::string& indent, const size_t level) const override {
       for (size_t i = 0; i < level; ++i)
         str << indent;
@@ -559,6 +602,120 @@ public:
     insert(newBounds, data);
   }
 
+  /**
+   * Updates the nodes with the given data with their new bounds.
+   *
+   * This is cheaper than calling update() for every object because the affected nodes are not
+   * removed and reinserted. Instead, the leafs are refit in place, and the bounds of their
+   * ancestors are updated. Refitting can degrade the quality of the tree if objects moved far, so
+   * every subtree whose bounds grew considerably is then either rebuilt from its leafs or the
+   * updated leafs in it are reinserted, depending on which is cheaper. If at least half of the
+   * objects in this tree are updated, the entire tree is rebuilt.
+   *
+   * @param objects the objects to update, a list of DataType
+   * @param getBounds a function from DataType -> Box to compute the new bounds of each object
+   *
+   * @throws NodeTreeException if no node can be found for any of the given objects, or any new
+   * bounds contains NaN
+   */
+  template <typename DataList, typename GetBounds>
+  void updateAll(const DataList& objects, GetBounds&& getBounds) {
+    if (objects.empty()) {
+      return;
+    }
+
+    const auto rebuildAll = 2 * objects.size() >= m_leafForData.size();
+
+    // find all leafs first so that the tree remains unchanged if an exception is thrown
+    auto updatedLeafs = std::vector<LeafNode*>{};
+    auto newBounds = std::vector<Box>{};
+    updatedLeafs.reserve(objects.size());
+    newBounds.reserve(objects.size());
+
+    for (const U& object : objects) {
+      const auto bounds = getBounds(object);
+      check(bounds);
+
+      auto it = m_leafForData.find(object);
+      if (it == m_leafForData.end()) {
+        throw NodeTreeException("AABB node not found");
+      }
+
+      updatedLeafs.push_back(it->second);
+      newBounds.push_back(bounds);
+    }
+
+    auto originalBounds = std::unordered_map<InnerNode*, Box>{};
+    for (size_t i = 0; i < updatedLeafs.size(); ++i) {
+      auto* leaf = updatedLeafs[i];
+      leaf->setBounds(newBounds[i]);
+
+      if (!rebuildAll) {
+        for (auto* parent = leaf->m_parent; parent != nullptr; parent = parent->m_parent) {
+          originalBounds.try_emplace(parent, parent->bounds());
+          if (!parent->refit()) {
+            break;
+          }
+        }
+      }
+    }
+
+    if (rebuildAll) {
+      rebuild(m_root);
+      return;
+    }
+
+    auto degradedNodes = std::unordered_set<const InnerNode*>{};
+    for (const auto& [innerNode, bounds] : originalBounds) {
+      if (isDegraded(bounds, innerNode->bounds())) {
+        degradedNodes.insert(innerNode);
+      }
+    }
+
+    if (degradedNodes.empty()) {
+      return;
+    }
+
+    // collect the updated leafs below the topmost degraded nodes, in the order they were updated
+    auto degradedSubtrees = std::vector<std::pair<InnerNode*, std::vector<U>>>{};
+    auto subtreeIndices = std::unordered_map<InnerNode*, size_t>{};
+    for (auto* leaf : updatedLeafs) {
+      InnerNode* topmostDegradedNode = nullptr;
+      for (auto* parent = leaf->m_parent; parent != nullptr; parent = parent->m_parent) {
+        if (degradedNodes.count(parent) > 0) {
+          topmostDegradedNode = parent;
+        }
+      }
+
+      if (topmostDegradedNode != nullptr) {
+        const auto [it, inserted] =
+          subtreeIndices.try_emplace(topmostDegradedNode, degradedSubtrees.size());
+        if (inserted) {
+          degradedSubtrees.emplace_back(topmostDegradedNode, std::vector<U>{});
+        }
+        degradedSubtrees[it->second].second.push_back(leaf->data());
+      }
+    }
+
+    // Rebuilding a subtree visits each of its leafs, while reinserting a leaf visits one node per
+    // level of the tree. All rebuilds happen first because removing a leaf can delete its parent.
+    auto dataToReinsert = std::vector<U>{};
+    for (auto& [subtree, data] : degradedSubtrees) {
+      const auto maxLeafCount = data.size() * height();
+      if (countLeafs(subtree, maxLeafCount) <= maxLeafCount) {
+        rebuild(subtree);
+      } else {
+        dataToReinsert.insert(dataToReinsert.end(), data.begin(), data.end());
+      }
+    }
+
+    for (const auto& data : dataToReinsert) {
+      const auto bounds = m_leafForData.at(data)->bounds();
+      remove(data);
+      insert(bounds, data);
+    }
+  }
+
 private:
   void check(const Box& bounds) const {
     if (vm::is_nan(bounds.min) || vm::is_nan(bounds.max)) {
@@ -566,6 +723,87 @@ private:
     }
   }
 
+  /**
+   * Indicates whether a node whose bounds changed from the given old bounds to the given new bounds
+   * should be restructured. This is the case if the sum of the extents of its bounds more than
+   * doubled.
+   */
+  static bool isDegraded(const Box& oldBounds, const Box& newBounds) {
+    const auto extents = [](const Box& bounds) {
+      const auto size = bounds.size();
+      auto result = static_cast<T>(0);
+      for (size_t i = 0; i < S; ++i) {
+        result += size[i];
+      }
+      return result;
+    };
+
+    return extents(newBounds) > static_cast<T>(2) * extents(oldBounds);
+  }
+
+  /**
+   * Counts the leafs of the subtree rooted at the given node, but stops counting once the count
+   * exceeds the given limit.
+   */
+  static size_t countLeafs(const Node* node, const size_t limit) {
+    auto count = size_t(0);
+    LambdaVisitor visitor(
+      [&](const InnerNode*) {
+        return count <= limit;
+      },
+      [&](const LeafNode*) {
+        ++count;
+      });
+    node->accept(visitor);
+    return count;
+  }
+
+  /**
+   * Replaces the subtree rooted at the given node with a new subtree built from its leafs.
+   */
+  void rebuild(Node* node) {
+    auto* parent = node->m_parent;
+
+    auto leafs = std::vector<LeafNode*>{};
+    auto* innerNodes = node->releaseLeafs(leafs);
+    auto* subtree = build(leafs.begin(), leafs.end());
+
+    if (parent == nullptr) {
+      subtree->m_parent = nullptr;
+      m_root = subtree;
+    } else {
+      m_root = parent->replaceChild(node, subtree);
+    }
+
+    delete innerNodes;
+  }
+
+  using LeafIterator = typename std::vector<LeafNode*>::iterator;
+
+  /**
+   * Builds a subtree from the given leafs by recursively splitting them at the median of their
+   * centers along the axis in which the centers are spread the most.
+   */
+  static Node* build(const LeafIterator first, const LeafIterator last) {
+    assert(first != last);
+    if (std::next(first) == last) {
+      return *first;
+    }
+
+    auto centerBounds = typename Box::builder{};
+    for (auto it = first; it != last; ++it) {
+      centerBounds.add((*it)->bounds().center());
+    }
+
+    const auto axis = vm::find_abs_max_component(centerBounds.bounds().size());
+    const auto mid = first + std::distance(first, last) / 2;
+    std::nth_element(first, mid, last, [&](const LeafNode* lhs, const LeafNode* rhs) {
+      return lhs->bounds().center()[axis] < rhs->bounds().center()[axis];
+    });
+
+    return new InnerNode(build(first, mid), build(mid, last));
+  }
+
 public:
   /**
    * Clears this node tree.
@@ -649,6 +887,43 @@ public:
     }
   }
 
+  /**
+   * Finds every data item in this tree whose bounding box intersects with the given box and returns
+   * a list of those items.
+   *
+   * @param bounds the box to test
+   * @return a list containing all found data items
+   */
+  List findIntersectors(const Box& bounds) const {
+    List result;
+    findIntersectors(bounds, std::back_inserter(result));
+    return result;
+  }
+
+  /**
+   * Finds every data item in this tree whose bounding box intersects with the given box and appends
+   * it to the given output iterator.
+   *
+   * @tparam O the output iterator type
+   * @param bounds the box to test
+   * @param out the output iterator to append to
+   */
+  template <typename O> void findIntersectors(const Box& bounds, O out) const {
+    if (!empty()) {
+      LambdaVisitor visitor(
+        [&](const InnerNode* innerNode) {
+          return innerNode->bounds().intersects(bounds);
+        },
+        [&](const LeafNode* leaf) {
+          if (leaf->bounds().intersects(bounds)) {
+            out = leaf->data();
+            ++out;
+          }
+        });
+      m_root->accept(visitor);
+    }
+  }
+
   /**
    * Finds every data item in this tree whose bounding box contains the given point and returns a
    * list of those items.
@@ -686,6 +961,35 @@ public:
     }
   }
 
+  /**
+   * Finds every data item in this tree whose bounding box satisfies the given predicate and appends
+   * it to the given output iterator.
+   *
+   * The predicate is also applied to the bounds of the inner nodes, and a subtree is skipped if its
+   * bounds do not satisfy the predicate. Therefore, whenever the predicate holds for a box, it must
+   * also hold for every box that contains it.
+   *
+   * @tparam P the predicate type, which must be a unary function that maps a box to a bool
+   * @tparam O the output iterator type
+   * @param predicate the predicate to test
+   * @param out the output iterator to append to
+   */
+  template <typename P, typename O> void findMatching(const P& predicate, O out) const {
+    if (!empty()) {
+      LambdaVisitor visitor(
+        [&](const InnerNode* innerNode) {
+          return predicate(innerNode->bounds());
+        },
+        [&](const LeafNode* leaf) {
+          if (predicate(leaf->bounds())) {
+            out = leaf->data();
+            ++out;
+          }
+        });
+      m_root->accept(visitor);
+    }
+  }
+
   /**
    * Prints a textual representation of this tree to the given output stream.
    *
@@ -144,36 +144,42 @@ bool Palette::indexedToRgba(
   reader.seekForward(
     pixelCount); // throws ReaderException if there aren't pixelCount bytes available
 
-  // Write rgba pixels
+  // Expand the indices, accumulate the color channels and check the alpha channel in a single
+  // pass over the image. Each palette entry is copied as a whole 32 bit word, and the loop is
+  // unrolled so that the compiler can keep the sums in registers and vectorize the accumulation.
   unsigned char* const rgbaData = rgbaImage.data();
-  for (size_t i = 0; i < pixelCount; ++i) {
-    const int index = static_cast<int>(indexedImage[i]);
-
-    std::memcpy(rgbaData + (i * 4), &paletteData[index * 4], 4);
-  }
-
-  // Check average color
   uint32_t colorSum[3] = {0, 0, 0};
-  for (size_t i = 0; i < pixelCount; ++i) {
-    colorSum[0] += static_cast<uint32_t>(rgbaData[(i * 4) + 0]);
-    colorSum[1] += static_cast<uint32_t>(rgbaData[(i * 4) + 1]);
-    colorSum[2] += static_cast<uint32_t>(rgbaData[(i * 4) + 2]);
+  unsigned char andAlpha = 0xff;
+
+  const auto expandPixel = [&](const size_t i) {
+    const unsigned char* entry = &paletteData[static_cast<size_t>(indexedImage[i]) * 4];
+    std::memcpy(rgbaData + (i * 4), entry, 4);
+    colorSum[0] += static_cast<uint32_t>(entry[0]);
+    colorSum[1] += static_cast<uint32_t>(entry[1]);
+    colorSum[2] += static_cast<uint32_t>(entry[2]);
+    andAlpha &= entry[3];
+  };
+
+  size_t i = 0;
+  for (; i + 4 <= pixelCount; i += 4) {
+    expandPixel(i + 0);
+    expandPixel(i + 1);
+    expandPixel(i + 2);
+    expandPixel(i + 3);
+  }
+  for (; i < pixelCount; ++i) {
+    expandPixel(i);
   }
+
   averageColor = Color(
     static_cast<float>(colorSum[0]) / (255.0f * static_cast<float>(pixelCount)),
     static_cast<float>(colorSum[1]) / (255.0f * static_cast<float>(pixelCount)),
     static_cast<float>(colorSum[2]) / (255.0f * static_cast<float>(pixelCount)), 1.0f);
 
-  // Check for transparency
-  bool hasTransparency = false;
-  if (transparency == PaletteTransparency::Index255Transparent) {
-    // Take the bitwise AND of the alpha channel of all pixels
-    unsigned char andAlpha = 0xff;
-    for (size_t i = 0; i < pixelCount; ++i) {
-      andAlpha &= rgbaData[(i * 4) + 3];
-    }
-    hasTransparency = (andAlpha != 0xff);
-  }
+  // The opaque palette has no transparent entries, so andAlpha can only differ from 0xff if the
+  // image uses the transparent index
+  const bool hasTransparency =
+    transparency == PaletteTransparency::Index255Transparent && andAlpha != 0xff;
 
   return hasTransparency;
 }
@@ -282,7 +282,8 @@ void Texture::prepare(const GLuint textureId, const int minFilter, const int mag
       glAssert(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
       glAssert(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
     } else if (m_buffers.size() == 1) {
-      // generate mipmaps if we don't have any
+      // the texture was loaded without mipmaps, so let OpenGL generate them; readers only compute
+      // mip levels themselves to replace corrupt ones (see Assets::generateMipmaps)
       glAssert(glTexParameteri(GL_TEXTURE_2D, GL_GENERATE_MIPMAP, GL_TRUE));
     } else {
       glAssert(glTexParameteri(
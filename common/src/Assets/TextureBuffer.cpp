@@ -25,7 +25,7 @@
 
 #include <FreeImage.h>
 
-#include <algorithm> // for std::max
+#include <algorithm> // for std::max, std::min
 
 namespace TrenchBroom {
 namespace Assets {
@@ -87,6 +87,51 @@ void setMipBufferSize(
   }
 }
 
+static void downsampleBox(
+  const unsigned char* src, const vm::vec2s& srcSize, unsigned char* dst, const vm::vec2s& dstSize,
+  const size_t bytesPerPixel) {
+  const auto srcPitch = srcSize.x() * bytesPerPixel;
+
+  for (size_t y = 0; y < dstSize.y(); ++y) {
+    // clamp the second row / column for odd and non square sizes
+    const auto y0 = std::min(2 * y, srcSize.y() - 1);
+    const auto y1 = std::min(2 * y + 1, srcSize.y() - 1);
+    const auto* row0 = src + y0 * srcPitch;
+    const auto* row1 = src + y1 * srcPitch;
+    auto* dstRow = dst + y * dstSize.x() * bytesPerPixel;
+
+    for (size_t x = 0; x < dstSize.x(); ++x) {
+      const auto x0 = std::min(2 * x, srcSize.x() - 1) * bytesPerPixel;
+      const auto x1 = std::min(2 * x + 1, srcSize.x() - 1) * bytesPerPixel;
+
+      for (size_t c = 0; c < bytesPerPixel; ++c) {
+        const auto sum = static_cast<unsigned int>(row0[x0 + c]) + row0[x1 + c] + row1[x0 + c] +
+                         row1[x1 + c];
+        dstRow[x * bytesPerPixel + c] = static_cast<unsigned char>((sum + 2u) / 4u);
+      }
+    }
+  }
+}
+
+void generateMipmaps(
+  TextureBufferList& buffers, const size_t firstLevel, const size_t width, const size_t height,
+  const GLenum format) {
+  ensure(firstLevel > 0, "cannot generate the base mip level");
+
+  const auto bytesPerPixel = bytesPerPixelForFormat(format);
+  for (size_t level = firstLevel; level < buffers.size(); ++level) {
+    const auto srcSize = sizeAtMipLevel(width, height, level - 1);
+    const auto dstSize = sizeAtMipLevel(width, height, level);
+    ensure(
+      buffers[level - 1].size() == bytesPerPixel * srcSize.x() * srcSize.y() &&
+        buffers[level].size() == bytesPerPixel * dstSize.x() * dstSize.y(),
+      "mip buffers have the expected sizes");
+
+    downsampleBox(
+      buffers[level - 1].data(), srcSize, buffers[level].data(), dstSize, bytesPerPixel);
+  }
+}
+
 void resizeMips(TextureBufferList& buffers, const vm::vec2s& oldSize, const vm::vec2s& newSize) {
   if (oldSize == newSize)
     return;
@@ -49,6 +49,18 @@ size_t bytesPerPixelForFormat(GLenum format);
 void setMipBufferSize(
   TextureBufferList& buffers, size_t mipLevels, size_t width, size_t height, GLenum format);
 
+/**
+ * Computes the mip levels starting at `firstLevel` by downsampling the respective previous level
+ * with a 2x2 box filter. The buffers must already have the sizes set by `setMipBufferSize`, and
+ * `firstLevel` must be greater than 0.
+ *
+ * Texture readers use this to replace mip levels that are truncated or corrupt in the texture file.
+ * Textures that are loaded without any mip levels are not affected; their mipmaps are generated by
+ * OpenGL when the texture is prepared.
+ */
+void generateMipmaps(
+  TextureBufferList& buffers, size_t firstLevel, size_t width, size_t height, GLenum format);
+
 void resizeMips(TextureBufferList& buffers, const vm::vec2s& oldSize, const vm::vec2s& newSize);
 } // namespace Assets
 } // namespace TrenchBroom
@@ -22,6 +22,22 @@
 #include "Exceptions.h"
 #include "IO/IOUtils.h"
 
+#ifdef _WIN32
+#include "IO/PathQt.h"
+
+#include <QString>
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace TrenchBroom {
 namespace IO {
 File::File(const Path& path)
@@ -91,6 +107,107 @@ std::FILE* CFile::file() const {
   return m_file;
 }
 
+#ifdef _WIN32
+MappedFile::MappedFile(const Path& path)
+  : File(path)
+  , m_begin(nullptr)
+  , m_size(0)
+  , m_mapping(nullptr) {
+  const auto wpath = pathAsQString(path).toStdWString();
+  auto file = CreateFileW(
+    wpath.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    throw FileSystemException("Cannot open file " + path.asString());
+  }
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size)) {
+    CloseHandle(file);
+    throw FileSystemException("Cannot get size of file " + path.asString());
+  }
+  m_size = static_cast<size_t>(size.QuadPart);
+
+  // empty files cannot be mapped
+  if (m_size > 0) {
+    m_mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (m_mapping == nullptr) {
+      throw FileSystemException("Cannot map file " + path.asString());
+    }
+
+    m_begin = static_cast<const char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+    if (m_begin == nullptr) {
+      CloseHandle(m_mapping);
+      throw FileSystemException("Cannot map file " + path.asString());
+    }
+  } else {
+    CloseHandle(file);
+  }
+}
+
+MappedFile::~MappedFile() {
+  if (m_begin != nullptr) {
+    UnmapViewOfFile(m_begin);
+  }
+  if (m_mapping != nullptr) {
+    CloseHandle(m_mapping);
+  }
+}
+#else
+MappedFile::MappedFile(const Path& path)
+  : File(path)
+  , m_begin(nullptr)
+  , m_size(0) {
+  const auto fd = open(path.asString().c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw FileSystemException("Cannot open file " + path.asString());
+  }
+
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) != 0) {
+    close(fd);
+    throw FileSystemException("Cannot get size of file " + path.asString());
+  }
+  m_size = static_cast<size_t>(fileStat.st_size);
+
+  // empty files cannot be mapped
+  if (m_size > 0) {
+    auto* addr = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED) {
+      close(fd);
+      throw FileSystemException("Cannot map file " + path.asString());
+    }
+    m_begin = static_cast<const char*>(addr);
+  }
+
+  // the mapping remains valid after the file descriptor is closed
+  close(fd);
+}
+
+MappedFile::~MappedFile() {
+  if (m_begin != nullptr) {
+    munmap(const_cast<char*>(m_begin), m_size);
+  }
+}
+#endif
+
+Reader MappedFile::reader() const {
+  return Reader::from(begin(), end());
+}
+
+size_t MappedFile::size() const {
+  return m_size;
+}
+
+const char* MappedFile::begin() const {
+  return m_begin;
+}
+
+const char* MappedFile::end() const {
+  return m_begin + m_size;
+}
+
 FileView::FileView(
   const Path& path, std::shared_ptr<File> file, const size_t offset, const size_t length)
   : File(path)
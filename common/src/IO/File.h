@@ -21,6 +21,7 @@
 
 #include "IO/Path.h"
 #include "IO/Reader.h"
+#include "Macros.h"
 
 #include <cstdio>
 #include <memory>
@@ -138,6 +139,55 @@ public:
   std::FILE* file() const;
 };
 
+/**
+ * A file that is backed by a physical file on the disk which is mapped into memory. The file is
+ * mapped read only in the constructor and unmapped in the destructor.
+ *
+ * Since the file contents are accessible as a memory buffer, readers and file views of this file
+ * point directly into the mapping, and buffering them does not copy any data. Consequently, such
+ * buffers are only valid as long as this file exists.
+ *
+ * The file is not locked while it is mapped, so other programs can still modify or delete it. If
+ * another program truncates the file, then accessing the truncated part of the mapping crashes the
+ * process (SIGBUS on POSIX systems). Therefore, only archive files that are not expected to change
+ * while they are in use (pak, wad and zip files) are mapped, and loose files are read using CFile.
+ */
+class MappedFile : public File {
+private:
+  const char* m_begin;
+  size_t m_size;
+#ifdef _WIN32
+  void* m_mapping;
+#endif
+
+public:
+  /**
+   * Creates a new file with the given path and maps it into memory.
+   *
+   * @param path the path of the file
+   *
+   * @throw FileSystemException if the file cannot be opened or mapped
+   */
+  explicit MappedFile(const Path& path);
+  ~MappedFile() override;
+
+  Reader reader() const override;
+  size_t size() const override;
+
+  /**
+   * Returns a pointer to the beginning of the mapped memory. If the file is empty, then nullptr is
+   * returned.
+   */
+  const char* begin() const;
+
+  /**
+   * Returns a pointer to the end of the mapped memory.
+   */
+  const char* end() const;
+
+  deleteCopyAndMove(MappedFile);
+};
+
 /**
  * A file that is backed by a portion of a physical file.
  */
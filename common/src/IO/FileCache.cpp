@@ -0,0 +1,110 @@
+/*
+ Copyright (C) 2010-2017 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "FileCache.h"
+
+#include "IO/File.h"
+
+namespace TrenchBroom {
+namespace IO {
+FileCache::FileCache(const size_t capacity)
+  : m_capacity(capacity)
+  , m_size(0) {}
+
+std::shared_ptr<File> FileCache::get(const void* owner, const size_t index) {
+  const auto lock = std::lock_guard<std::mutex>{m_mutex};
+
+  const auto it = m_index.find(Key{owner, index});
+  if (it == std::end(m_index)) {
+    return nullptr;
+  }
+
+  // move the entry to the front of the list
+  m_entries.splice(std::begin(m_entries), m_entries, it->second);
+  return it->second->second;
+}
+
+void FileCache::put(const void* owner, const size_t index, std::shared_ptr<File> file) {
+  const auto lock = std::lock_guard<std::mutex>{m_mutex};
+
+  const auto fileSize = file->size();
+  if (fileSize > m_capacity / 4) {
+    return;
+  }
+
+  const auto key = Key{owner, index};
+  const auto it = m_index.find(key);
+  if (it != std::end(m_index)) {
+    m_size -= it->second->second->size();
+    m_entries.erase(it->second);
+    m_index.erase(it);
+  }
+
+  m_entries.emplace_front(key, std::move(file));
+  m_index.emplace(key, std::begin(m_entries));
+  m_size += fileSize;
+
+  evictToCapacity();
+}
+
+void FileCache::evict(const void* owner) {
+  const auto lock = std::lock_guard<std::mutex>{m_mutex};
+
+  auto it = m_index.lower_bound(Key{owner, 0});
+  while (it != std::end(m_index) && it->first.first == owner) {
+    m_size -= it->second->second->size();
+    m_entries.erase(it->second);
+    it = m_index.erase(it);
+  }
+}
+
+void FileCache::clear() {
+  const auto lock = std::lock_guard<std::mutex>{m_mutex};
+
+  m_entries.clear();
+  m_index.clear();
+  m_size = 0;
+}
+
+size_t FileCache::size() const {
+  const auto lock = std::lock_guard<std::mutex>{m_mutex};
+  return m_size;
+}
+
+size_t FileCache::capacity() const {
+  const auto lock = std::lock_guard<std::mutex>{m_mutex};
+  return m_capacity;
+}
+
+void FileCache::setCapacity(const size_t capacity) {
+  const auto lock = std::lock_guard<std::mutex>{m_mutex};
+  m_capacity = capacity;
+  evictToCapacity();
+}
+
+void FileCache::evictToCapacity() {
+  while (m_size > m_capacity && !m_entries.empty()) {
+    const auto& [key, file] = m_entries.back();
+    m_size -= file->size();
+    m_index.erase(key);
+    m_entries.pop_back();
+  }
+}
+} // namespace IO
+} // namespace TrenchBroom
@@ -0,0 +1,97 @@
+/*
+ Copyright (C) 2010-2017 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace TrenchBroom {
+namespace IO {
+class File;
+
+/**
+ * A thread safe cache of files that keeps the most recently used files in memory until their total
+ * size exceeds a given capacity in bytes. When that happens, the least recently used files are
+ * evicted.
+ *
+ * Files are identified by an owner, e.g. the file system that created them, and an index that is
+ * unique per owner. Evicting a file only drops the cache's reference to it, so files that are still
+ * in use elsewhere remain valid.
+ */
+class FileCache {
+private:
+  using Key = std::pair<const void*, size_t>;
+  using Entry = std::pair<Key, std::shared_ptr<File>>;
+  using EntryList = std::list<Entry>;
+
+  mutable std::mutex m_mutex;
+  size_t m_capacity;
+  size_t m_size;
+  EntryList m_entries;
+  std::map<Key, EntryList::iterator> m_index;
+
+public:
+  /**
+   * Creates a new cache with the given capacity in bytes.
+   */
+  explicit FileCache(size_t capacity);
+
+  /**
+   * Returns the cached file with the given owner and index and marks it as most recently used, or
+   * nullptr if no such file is cached.
+   */
+  std::shared_ptr<File> get(const void* owner, size_t index);
+
+  /**
+   * Adds the given file to this cache, replacing any file that was cached with the same owner and
+   * index. Files that are larger than a quarter of the capacity are not cached.
+   */
+  void put(const void* owner, size_t index, std::shared_ptr<File> file);
+
+  /**
+   * Evicts all files with the given owner.
+   */
+  void evict(const void* owner);
+
+  /**
+   * Evicts all files.
+   */
+  void clear();
+
+  /**
+   * Returns the total size in bytes of the cached files.
+   */
+  size_t size() const;
+
+  size_t capacity() const;
+
+  /**
+   * Sets the capacity in bytes, evicting the least recently used files if necessary.
+   */
+  void setCapacity(size_t capacity);
+
+private:
+  void evictToCapacity();
+};
+} // namespace IO
+} // namespace TrenchBroom
@@ -49,6 +49,13 @@ std::shared_ptr<FileSystem> FileSystem::releaseNext() {
   return std::move(m_next);
 }
 
+void FileSystem::setNext(std::shared_ptr<FileSystem> next) {
+  if (m_next) {
+    throw FileSystemException("File system already has a next file system");
+  }
+  m_next = std::move(next);
+}
+
 bool FileSystem::canMakeAbsolute(const Path& path) const {
   return !path.isAbsolute();
 }
@@ -57,6 +57,16 @@ public: // public API
   const FileSystem& next() const;
   std::shared_ptr<FileSystem> releaseNext();
 
+  /**
+   * Sets the next file system in the search path. This allows file systems to be created
+   * independently of each other, e.g. in parallel, and to be chained afterwards.
+   *
+   * @param next the next file system
+   *
+   * @throw FileSystemException if this file system already has a next file system
+   */
+  void setNext(std::shared_ptr<FileSystem> next);
+
   bool canMakeAbsolute(const Path& path) const;
   Path makeAbsolute(const Path& path) const;
 
@@ -23,6 +23,8 @@
 #include "IO/DiskFileSystem.h"
 #include "IO/File.h"
 
+#include <kdl/string_format.h>
+
 #include <cassert>
 #include <memory>
 
@@ -70,32 +72,6 @@ void ImageFileSystemBase::Directory::addFile(const Path& path, std::unique_ptr<F
   }
 }
 
-bool ImageFileSystemBase::Directory::directoryExists(const Path& path) const {
-  if (path.isEmpty()) {
-    return true;
-  }
-
-  auto it = m_directories.find(path.firstComponent());
-  if (it == std::end(m_directories)) {
-    return false;
-  } else {
-    return it->second->directoryExists(path.deleteFirstComponent());
-  }
-}
-
-bool ImageFileSystemBase::Directory::fileExists(const Path& path) const {
-  if (path.length() == 1) {
-    return m_files.count(path) > 0;
-  }
-
-  auto it = m_directories.find(path.firstComponent());
-  if (it == std::end(m_directories)) {
-    return false;
-  } else {
-    return it->second->fileExists(path.deleteFirstComponent());
-  }
-}
-
 const ImageFileSystemBase::Directory& ImageFileSystemBase::Directory::findDirectory(
   const Path& path) const {
   if (path.isEmpty()) {
@@ -110,28 +86,6 @@ const ImageFileSystemBase::Directory& ImageFileSystemBase::Directory::findDirect
   }
 }
 
-const ImageFileSystemBase::FileEntry& ImageFileSystemBase::Directory::findFile(
-  const Path& path) const {
-  assert(!path.isEmpty());
-
-  const auto name = path.firstComponent();
-  if (path.length() == 1) {
-    auto it = m_files.find(name);
-    if (it == std::end(m_files)) {
-      throw FileSystemException("File not found: '" + (m_path + path).asString() + "'");
-    } else {
-      return *it->second;
-    }
-  } else {
-    auto it = m_directories.find(name);
-    if (it == std::end(m_directories)) {
-      throw FileSystemException("File not found: '" + (m_path + path).asString() + "'");
-    } else {
-      return it->second->findFile(path.deleteFirstComponent());
-    }
-  }
-}
-
 std::vector<Path> ImageFileSystemBase::Directory::contents() const {
   std::vector<Path> contents;
 
@@ -146,6 +100,20 @@ std::vector<Path> ImageFileSystemBase::Directory::contents() const {
   return contents;
 }
 
+void ImageFileSystemBase::Directory::index(
+  const std::string& prefix, std::unordered_map<std::string, const FileEntry*>& fileIndex,
+  std::unordered_set<std::string>& directoryIndex) const {
+  for (const auto& [name, file] : m_files) {
+    fileIndex[prefix + kdl::str_to_lower(name.asString())] = file.get();
+  }
+
+  for (const auto& [name, directory] : m_directories) {
+    const auto directoryKey = prefix + kdl::str_to_lower(name.asString());
+    directoryIndex.insert(directoryKey);
+    directory->index(directoryKey + "/", fileIndex, directoryIndex);
+  }
+}
+
 ImageFileSystemBase::Directory& ImageFileSystemBase::Directory::findOrCreateDirectory(
   const Path& path) {
   if (path.isEmpty()) {
@@ -170,6 +138,7 @@ ImageFileSystemBase::~ImageFileSystemBase() = default;
 void ImageFileSystemBase::initialize() {
   try {
     doReadDirectory();
+    buildIndex();
   } catch (const std::exception& e) {
     throw FileSystemException(
       "Could not initialize image file system '" + m_path.asString() + "': " + e.what());
@@ -181,14 +150,25 @@ void ImageFileSystemBase::reload() {
   initialize();
 }
 
+void ImageFileSystemBase::buildIndex() {
+  m_fileIndex.clear();
+  m_directoryIndex.clear();
+
+  // the empty path denotes the root directory
+  m_directoryIndex.insert("");
+  m_root.index("", m_fileIndex, m_directoryIndex);
+}
+
+std::string ImageFileSystemBase::indexKey(const Path& path) {
+  return path.makeLowerCase().makeCanonical().asString("/");
+}
+
 bool ImageFileSystemBase::doDirectoryExists(const Path& path) const {
-  const auto searchPath = path.makeLowerCase().makeCanonical();
-  return m_root.directoryExists(searchPath);
+  return m_directoryIndex.count(indexKey(path)) > 0;
 }
 
 bool ImageFileSystemBase::doFileExists(const Path& path) const {
-  const auto searchPath = path.makeLowerCase().makeCanonical();
-  return m_root.fileExists(searchPath);
+  return m_fileIndex.count(indexKey(path)) > 0;
 }
 
 std::vector<Path> ImageFileSystemBase::doGetDirectoryContents(const Path& path) const {
@@ -198,13 +178,16 @@ std::vector<Path> ImageFileSystemBase::doGetDirectoryContents(const Path& path)
 }
 
 std::shared_ptr<File> ImageFileSystemBase::doOpenFile(const Path& path) const {
-  const auto searchPath = path.makeLowerCase().makeCanonical();
-  return m_root.findFile(path).open();
+  const auto it = m_fileIndex.find(indexKey(path));
+  if (it == std::end(m_fileIndex)) {
+    throw FileSystemException("File not found: '" + (m_path + path).asString() + "'");
+  }
+  return it->second->open();
 }
 
 ImageFileSystem::ImageFileSystem(std::shared_ptr<FileSystem> next, const Path& path)
   : ImageFileSystemBase(std::move(next), path)
-  , m_file(std::make_shared<CFile>(path)) {
+  , m_file(std::make_shared<MappedFile>(path)) {
   ensure(m_path.isAbsolute(), "path must be absolute");
 }
 } // namespace IO
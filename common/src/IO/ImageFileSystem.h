@@ -26,11 +26,14 @@
 
 #include <map>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace TrenchBroom {
 namespace IO {
-class CFile;
 class File;
+class MappedFile;
 
 class ImageFileSystemBase : public FileSystem {
 protected:
@@ -85,13 +88,17 @@ protected:
     void addFile(const Path& path, std::shared_ptr<File> file);
     void addFile(const Path& path, std::unique_ptr<FileEntry> file);
 
-    bool directoryExists(const Path& path) const;
-    bool fileExists(const Path& path) const;
-
     const Directory& findDirectory(const Path& path) const;
-    const FileEntry& findFile(const Path& path) const;
     std::vector<Path> contents() const;
 
+    /**
+     * Adds the files and sub directories of this directory and all of its sub directories to the
+     * given indices. The keys are the lower case paths of the items relative to the given prefix.
+     */
+    void index(
+      const std::string& prefix, std::unordered_map<std::string, const FileEntry*>& fileIndex,
+      std::unordered_set<std::string>& directoryIndex) const;
+
   private:
     Directory& findOrCreateDirectory(const Path& path);
   };
@@ -100,6 +107,15 @@ protected:
   Path m_path;
   Directory m_root;
 
+private:
+  /**
+   * Flat indices of all files and directories, keyed by their lower case paths. These are built
+   * after the directory was read and allow answering existence queries and opening files with a
+   * single hash lookup instead of walking the directory tree with case insensitive comparisons.
+   */
+  std::unordered_map<std::string, const FileEntry*> m_fileIndex;
+  std::unordered_set<std::string> m_directoryIndex;
+
 protected:
   ImageFileSystemBase(std::shared_ptr<FileSystem> next, const Path& path);
 
@@ -116,6 +132,9 @@ public:
   void reload();
 
 private:
+  void buildIndex();
+  static std::string indexKey(const Path& path);
+
   bool doDirectoryExists(const Path& path) const override;
   bool doFileExists(const Path& path) const override;
 
@@ -128,7 +147,7 @@ private:
 
 class ImageFileSystem : public ImageFileSystemBase {
 protected:
-  std::shared_ptr<CFile> m_file;
+  std::shared_ptr<MappedFile> m_file;
 
 protected:
   ImageFileSystem(std::shared_ptr<FileSystem> next, const Path& path);
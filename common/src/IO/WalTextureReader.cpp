@@ -20,6 +20,7 @@
 #include "WalTextureReader.h"
 
 #include "Assets/Texture.h"
+#include "Assets/TextureBuffer.h"
 #include "Ensure.h"
 #include "IO/File.h"
 #include "IO/Path.h"
@@ -177,10 +178,13 @@ bool WalTextureReader::readMips(
     const auto size = curWidth * curHeight;
 
     // FIXME: Confirm this is actually happening because of bad data and not a bug.
-    // FIXME: Corrupt or missing mips should be deleted, rather than uploaded with garbage.
     if (!reader.canRead(size)) {
       std::cerr << "WalTextureReader::readMips: buffer overrun\n";
-      return false;
+      if (i > 0) {
+        // rebuild the corrupt or missing mips from the last good one instead of uploading garbage
+        Assets::generateMipmaps(buffers, i, width, height, GL_RGBA);
+      }
+      return hasTransparency;
     }
 
     hasTransparency |=
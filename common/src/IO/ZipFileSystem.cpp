@@ -21,6 +21,8 @@
 
 #include "IO/DiskFileSystem.h"
 #include "IO/File.h"
+#include "IO/FileCache.h"
+#include "IO/Reader.h"
 
 #include <memory>
 #include <string>
@@ -29,27 +31,112 @@ namespace TrenchBroom {
 namespace IO {
 // ZipFileSystem::ZipCompressedFile
 
-ZipFileSystem::ZipCompressedFile::ZipCompressedFile(ZipFileSystem* owner, const mz_uint fileIndex)
+ZipFileSystem::ZipCompressedFile::ZipCompressedFile(
+  ZipFileSystem* owner, Path path, const mz_uint fileIndex, const Stat& stat)
   : m_owner(owner)
-  , m_fileIndex(fileIndex) {}
+  , m_path(std::move(path))
+  , m_fileIndex(fileIndex)
+  , m_stat(stat) {}
 
 std::shared_ptr<File> ZipFileSystem::ZipCompressedFile::doOpen() const {
-  const auto path = Path(m_owner->filename(m_fileIndex));
+  if (auto cachedFile = inflatedFileCache().get(m_owner, m_fileIndex)) {
+    return cachedFile;
+  }
+
+  if (m_stat.readable) {
+    switch (m_stat.method) {
+      case MZ_NO_COMPRESSION:
+        return openStored(dataOffset());
+      case MZ_DEFLATED:
+        return openDeflated(dataOffset());
+    }
+  }
+  return openWithArchive();
+}
+
+std::shared_ptr<File> ZipFileSystem::ZipCompressedFile::openStored(const size_t offset) const {
+  const auto size = static_cast<size_t>(m_stat.uncompressedSize);
+  if (offset + size > m_owner->m_file->size()) {
+    throw FileSystemException("Invalid stored entry " + m_path.asString());
+  }
+
+  // no need to cache anything, the view points into the memory mapped archive
+  return std::make_shared<FileView>(m_path, m_owner->m_file, offset, size);
+}
+
+std::shared_ptr<File> ZipFileSystem::ZipCompressedFile::openDeflated(const size_t offset) const {
+  const auto compressedSize = static_cast<size_t>(m_stat.compressedSize);
+  if (offset + compressedSize > m_owner->m_file->size()) {
+    throw FileSystemException("Invalid compressed entry " + m_path.asString());
+  }
+
+  const auto uncompressedSize = static_cast<size_t>(m_stat.uncompressedSize);
+  auto data = std::make_unique<char[]>(uncompressedSize);
+
+  const auto* compressedData = m_owner->m_file->begin() + offset;
+  if (
+    tinfl_decompress_mem_to_mem(
+      data.get(), uncompressedSize, compressedData, compressedSize, 0) != uncompressedSize) {
+    throw FileSystemException("tinfl_decompress_mem_to_mem failed for " + m_path.asString());
+  }
 
-  mz_zip_archive_file_stat stat;
-  if (!mz_zip_reader_file_stat(&m_owner->m_archive, m_fileIndex, &stat)) {
-    throw FileSystemException("mz_zip_reader_file_stat failed for " + path.asString());
+  if (
+    mz_crc32(
+      MZ_CRC32_INIT, reinterpret_cast<const unsigned char*>(data.get()), uncompressedSize) !=
+    m_stat.crc32) {
+    throw FileSystemException("CRC check failed for " + m_path.asString());
   }
 
-  const auto uncompressedSize = static_cast<size_t>(stat.m_uncomp_size);
+  auto file = std::make_shared<OwningBufferFile>(m_path, std::move(data), uncompressedSize);
+  inflatedFileCache().put(m_owner, m_fileIndex, file);
+  return file;
+}
+
+std::shared_ptr<File> ZipFileSystem::ZipCompressedFile::openWithArchive() const {
+  const auto uncompressedSize = static_cast<size_t>(m_stat.uncompressedSize);
   auto data = std::make_unique<char[]>(uncompressedSize);
-  auto* begin = data.get();
 
-  if (!mz_zip_reader_extract_to_mem(&m_owner->m_archive, m_fileIndex, begin, uncompressedSize, 0)) {
-    throw FileSystemException("mz_zip_reader_extract_to_mem failed for " + path.asString());
+  {
+    const auto lock = std::lock_guard<std::mutex>{m_owner->m_archiveMutex};
+    if (!mz_zip_reader_extract_to_mem(
+          &m_owner->m_archive, m_fileIndex, data.get(), uncompressedSize, 0)) {
+      throw FileSystemException("mz_zip_reader_extract_to_mem failed for " + m_path.asString());
+    }
   }
 
-  return std::make_shared<OwningBufferFile>(path, std::move(data), uncompressedSize);
+  auto file = std::make_shared<OwningBufferFile>(m_path, std::move(data), uncompressedSize);
+  inflatedFileCache().put(m_owner, m_fileIndex, file);
+  return file;
+}
+
+/**
+ * Returns the offset of the entry's data from the beginning of the archive. The local header's file
+ * name and extra field lengths can differ from those in the central directory, so they must be read
+ * from the local header itself.
+ */
+size_t ZipFileSystem::ZipCompressedFile::dataOffset() const {
+  static constexpr size_t LocalHeaderSize = 30;
+  static constexpr size_t FilenameLengthOffset = 26;
+  static constexpr size_t ExtraLengthOffset = 28;
+  static constexpr uint32_t LocalHeaderSignature = 0x04034b50;
+
+  const auto headerOffset = static_cast<size_t>(m_stat.localHeaderOffset);
+  if (headerOffset + LocalHeaderSize > m_owner->m_file->size()) {
+    throw FileSystemException("Invalid local header offset for " + m_path.asString());
+  }
+
+  auto reader = m_owner->m_file->reader();
+  reader.seekFromBegin(headerOffset);
+  if (reader.readUnsignedInt<uint32_t>() != LocalHeaderSignature) {
+    throw FileSystemException("Invalid local header for " + m_path.asString());
+  }
+
+  reader.seekFromBegin(headerOffset + FilenameLengthOffset);
+  const auto filenameLength = reader.readSize<uint16_t>();
+  reader.seekFromBegin(headerOffset + ExtraLengthOffset);
+  const auto extraLength = reader.readSize<uint16_t>();
+
+  return headerOffset + LocalHeaderSize + filenameLength + extraLength;
 }
 
 // ZipFileSystem
@@ -63,21 +150,38 @@ ZipFileSystem::ZipFileSystem(std::shared_ptr<FileSystem> next, const Path& path)
 }
 
 ZipFileSystem::~ZipFileSystem() {
+  inflatedFileCache().evict(this);
   mz_zip_reader_end(&m_archive);
 }
 
+FileCache& ZipFileSystem::inflatedFileCache() {
+  static auto cache = FileCache{64u * 1024u * 1024u};
+  return cache;
+}
+
 void ZipFileSystem::doReadDirectory() {
+  // the file indices are not stable across reloads
+  inflatedFileCache().evict(this);
+
   mz_zip_zero_struct(&m_archive);
 
-  if (mz_zip_reader_init_cfile(&m_archive, m_file->file(), m_file->size(), 0) != MZ_TRUE) {
-    throw FileSystemException("Error calling mz_zip_reader_init_cfile");
+  if (mz_zip_reader_init_mem(&m_archive, m_file->begin(), m_file->size(), 0) != MZ_TRUE) {
+    throw FileSystemException("Error calling mz_zip_reader_init_mem");
   }
 
   const mz_uint numFiles = mz_zip_reader_get_num_files(&m_archive);
   for (mz_uint i = 0; i < numFiles; ++i) {
     if (!mz_zip_reader_is_file_a_directory(&m_archive, i)) {
-      const auto path = Path(filename(i));
-      m_root.addFile(path, std::make_unique<ZipCompressedFile>(this, i));
+      mz_zip_archive_file_stat stat;
+      if (mz_zip_reader_file_stat(&m_archive, i, &stat)) {
+        auto path = Path(filename(i));
+        m_root.addFile(
+          path, std::make_unique<ZipCompressedFile>(
+                  this, path, i,
+                  ZipCompressedFile::Stat{
+                    stat.m_local_header_ofs, stat.m_comp_size, stat.m_uncomp_size, stat.m_crc32,
+                    stat.m_method, !stat.m_is_encrypted && stat.m_is_supported}));
+      }
     }
   }
 
@@ -22,6 +22,8 @@
 #include "IO/ImageFileSystem.h"
 
 #include <memory>
+#include <mutex>
+#include <string>
 
 #include <miniz/miniz.h>
 
@@ -29,21 +31,52 @@ namespace TrenchBroom {
 namespace IO {
 class Path;
 
+class FileCache;
+
 class ZipFileSystem : public ImageFileSystem {
 private:
   mz_zip_archive m_archive;
+  std::mutex m_archiveMutex;
 
 private:
+  /**
+   * Entries are opened without touching the shared archive state whenever possible. Stored entries
+   * are views into the memory mapped archive, and deflated entries are inflated directly from the
+   * mapping. Only entries with unsupported compression methods fall back to miniz, in which case
+   * access to the archive is serialized.
+   */
   class ZipCompressedFile : public FileEntry {
+  public:
+    /**
+     * The parts of an entry's central directory record that are needed to read its data. The full
+     * mz_zip_archive_file_stat is not kept because it contains fixed size buffers for the file name
+     * and the comment, which would cost more than a kilobyte per entry.
+     */
+    struct Stat {
+      mz_uint64 localHeaderOffset;
+      mz_uint64 compressedSize;
+      mz_uint64 uncompressedSize;
+      mz_uint32 crc32;
+      mz_uint16 method;
+      bool readable;
+    };
+
   private:
     ZipFileSystem* m_owner;
+    Path m_path;
     mz_uint m_fileIndex;
+    Stat m_stat;
 
   public:
-    ZipCompressedFile(ZipFileSystem* owner, mz_uint fileIndex);
+    ZipCompressedFile(ZipFileSystem* owner, Path path, mz_uint fileIndex, const Stat& stat);
 
   private:
     std::shared_ptr<File> doOpen() const override;
+
+    std::shared_ptr<File> openStored(size_t dataOffset) const;
+    std::shared_ptr<File> openDeflated(size_t dataOffset) const;
+    std::shared_ptr<File> openWithArchive() const;
+    size_t dataOffset() const;
   };
   friend class ZipCompressedFile;
 
@@ -52,6 +85,11 @@ public:
   ZipFileSystem(std::shared_ptr<FileSystem> next, const Path& path);
   ~ZipFileSystem() override;
 
+  /**
+   * Returns the cache of inflated entries that is shared by all zip file systems.
+   */
+  static FileCache& inflatedFileCache();
+
 private:
   void doReadDirectory() override;
 
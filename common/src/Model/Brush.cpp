@@ -38,6 +38,7 @@
 #include <vecmath/mat.h>
 #include <vecmath/mat_ext.h>
 #include <vecmath/polygon.h>
+#include <vecmath/scalar.h>
 #include <vecmath/segment.h>
 #include <vecmath/util.h>
 #include <vecmath/vec.h>
@@ -51,20 +52,35 @@
 
 namespace TrenchBroom {
 namespace Model {
-class Brush::CopyCallback : public BrushGeometry::CopyCallback {
-public:
-  void faceWasCopied(const BrushFaceGeometry* original, BrushFaceGeometry* copy) const override {
-    copy->setPayload(original->payload());
+/**
+ * The cost of building a brush by intersecting its face planes grows with the fourth power of its
+ * face count, while clipping grows roughly linearly. Plane intersection is faster up to about 16
+ * faces (see BrushGeometryBenchmark), so brushes with more faces are always built by clipping.
+ */
+static constexpr size_t MaxFaceCountForPlaneIntersection = 16u;
+
+/**
+ * Checks every vertex coordinate without an early exit, so that the compiler can vectorize the
+ * inner loop.
+ */
+static bool hasNonIntegerCoordinates(const BrushGeometry& geometry) {
+  auto result = false;
+  for (const BrushVertex* vertex : geometry.vertices()) {
+    const auto& position = vertex->position();
+    for (size_t i = 0u; i < 3u; ++i) {
+      result |= !vm::is_integral(position[i]);
+    }
   }
-};
+  return result;
+}
 
 Brush::Brush() {}
 
 Brush::Brush(const Brush& other)
   : m_faces(other.m_faces)
-  , m_geometry(
-      other.m_geometry ? std::make_unique<BrushGeometry>(*other.m_geometry, CopyCallback())
-                       : nullptr) {
+  , m_geometry(other.m_geometry)
+  , m_hasNonIntegerVertices(other.m_hasNonIntegerVertices) {
+  // copied faces are not linked to any geometry, so link them to the shared geometry
   if (m_geometry) {
     for (BrushFaceGeometry* faceGeometry : m_geometry->faces()) {
       if (const auto faceIndex = faceGeometry->payload()) {
@@ -77,7 +93,8 @@ Brush::Brush(const Brush& other)
 
 Brush::Brush(Brush&& other) noexcept
   : m_faces(std::move(other.m_faces))
-  , m_geometry(std::move(other.m_geometry)) {}
+  , m_geometry(std::move(other.m_geometry))
+  , m_hasNonIntegerVertices(other.m_hasNonIntegerVertices) {}
 
 Brush& Brush::operator=(Brush other) noexcept {
   using std::swap;
@@ -89,6 +106,7 @@ void swap(Brush& lhs, Brush& rhs) noexcept {
   using std::swap;
   swap(lhs.m_faces, rhs.m_faces);
   swap(lhs.m_geometry, rhs.m_geometry);
+  swap(lhs.m_hasNonIntegerVertices, rhs.m_hasNonIntegerVertices);
 }
 
 Brush::~Brush() = default;
@@ -108,17 +126,39 @@ kdl::result<void, BrushError> Brush::updateGeometryFromFaces(const vm::bbox3& wo
   // First, add all faces to the brush geometry
   BrushFace::sortFaces(m_faces);
 
-  auto geometry = std::make_unique<BrushGeometry>(worldBounds);
-
-  for (size_t i = 0u; i < m_faces.size(); ++i) {
-    BrushFace& face = m_faces[i];
-    const auto result = geometry->clip(face.boundary());
-    if (result.success()) {
-      BrushFaceGeometry* faceGeometry = result.face();
-      face.setGeometry(faceGeometry);
-      faceGeometry->setPayload(i);
-    } else if (result.empty()) {
-      return BrushError::EmptyBrush;
+  auto geometry = std::shared_ptr<BrushGeometry>{};
+
+  // Brushes with few faces are usually simple polyhedra, which can be built much faster by
+  // intersecting the face planes directly than by clipping a cube with every face.
+  if (m_faces.size() <= MaxFaceCountForPlaneIntersection) {
+    const auto planes = kdl::vec_transform(m_faces, [](const BrushFace& face) {
+      return face.boundary();
+    });
+    auto faceGeometries = std::vector<BrushFaceGeometry*>{};
+    if (auto polyhedron = BrushGeometry::fromPlanes(planes, worldBounds, faceGeometries)) {
+      geometry = std::make_shared<BrushGeometry>(std::move(*polyhedron));
+      for (size_t i = 0u; i < m_faces.size(); ++i) {
+        if (BrushFaceGeometry* faceGeometry = faceGeometries[i]) {
+          m_faces[i].setGeometry(faceGeometry);
+          faceGeometry->setPayload(i);
+        }
+      }
+    }
+  }
+
+  if (!geometry) {
+    geometry = std::make_shared<BrushGeometry>(worldBounds);
+
+    for (size_t i = 0u; i < m_faces.size(); ++i) {
+      BrushFace& face = m_faces[i];
+      const auto result = geometry->clip(face.boundary());
+      if (result.success()) {
+        BrushFaceGeometry* faceGeometry = result.face();
+        face.setGeometry(faceGeometry);
+        faceGeometry->setPayload(i);
+      } else if (result.empty()) {
+        return BrushError::EmptyBrush;
+      }
     }
   }
 
@@ -142,6 +182,7 @@ kdl::result<void, BrushError> Brush::updateGeometryFromFaces(const vm::bbox3& wo
   }
 
   m_faces = std::move(remainingFaces);
+  m_hasNonIntegerVertices = hasNonIntegerCoordinates(*geometry);
   m_geometry = std::move(geometry);
 
   assert(checkFaceLinks());
@@ -154,6 +195,10 @@ const vm::bbox3& Brush::bounds() const {
   return m_geometry->bounds();
 }
 
+size_t Brush::geometryShareCount() const {
+  return m_geometry ? size_t(m_geometry.use_count()) : 0u;
+}
+
 std::optional<size_t> Brush::findFace(const std::string& textureName) const {
   return kdl::vec_index_of(m_faces, [&](const BrushFace& face) {
     return face.attributes().textureName() == textureName;
@@ -342,6 +387,11 @@ size_t Brush::vertexCount() const {
   return m_geometry->vertexCount();
 }
 
+bool Brush::hasNonIntegerVertices() const {
+  ensure(m_geometry != nullptr, "geometry is null");
+  return m_hasNonIntegerVertices;
+}
+
 const Brush::VertexList& Brush::vertices() const {
   ensure(m_geometry != nullptr, "geometry is null");
   return m_geometry->vertices();
@@ -354,6 +404,9 @@ const std::vector<vm::vec3> Brush::vertexPositions() const {
 
 bool Brush::hasVertex(const vm::vec3& position, const FloatType epsilon) const {
   ensure(m_geometry != nullptr, "geometry is null");
+  if (!bounds().expand(epsilon).contains(position)) {
+    return false;
+  }
   return m_geometry->findVertexByPosition(position, epsilon) != nullptr;
 }
 
@@ -417,11 +470,21 @@ std::vector<vm::polygon3> Brush::findClosestFacePositions(
 
 bool Brush::hasEdge(const vm::segment3& edge, const FloatType epsilon) const {
   ensure(m_geometry != nullptr, "geometry is null");
+  const auto searchBounds = bounds().expand(epsilon);
+  if (!searchBounds.contains(edge.start()) || !searchBounds.contains(edge.end())) {
+    return false;
+  }
   return m_geometry->findEdgeByPositions(edge.start(), edge.end(), epsilon) != nullptr;
 }
 
 bool Brush::hasFace(const vm::polygon3& face, const FloatType epsilon) const {
   ensure(m_geometry != nullptr, "geometry is null");
+  const auto searchBounds = bounds().expand(epsilon);
+  for (const auto& vertex : face.vertices()) {
+    if (!searchBounds.contains(vertex)) {
+      return false;
+    }
+  }
   return m_geometry->hasFace(face.vertices(), epsilon);
 }
 
@@ -467,7 +530,14 @@ std::vector<const BrushFace*> Brush::incidentFaces(const BrushVertex* vertex) co
 bool Brush::canMoveVertices(
   const vm::bbox3& worldBounds, const std::vector<vm::vec3>& vertices,
   const vm::vec3& delta) const {
-  return doCanMoveVertices(worldBounds, vertices, delta, true).success;
+  return validateMoveVertices(worldBounds, vertices, delta).success;
+}
+
+Brush::CanMoveVerticesResult Brush::validateMoveVertices(
+  const vm::bbox3& worldBounds, const std::vector<vm::vec3>& vertices,
+  const vm::vec3& delta) const {
+  ensure(m_geometry != nullptr, "geometry is null");
+  return doCanMoveVertices(worldBounds, vertices, delta, true);
 }
 
 kdl::result<void, BrushError> Brush::moveVertices(
@@ -476,6 +546,15 @@ kdl::result<void, BrushError> Brush::moveVertices(
   return doMoveVertices(worldBounds, vertexPositions, delta, uvLock);
 }
 
+kdl::result<void, BrushError> Brush::moveVertices(
+  const vm::bbox3& worldBounds, const std::vector<vm::vec3>& vertexPositions, const vm::vec3& delta,
+  const CanMoveVerticesResult& canMoveResult, const bool uvLock) {
+  if (!canMoveResult.success) {
+    return BrushError::InvalidBrush;
+  }
+  return doMoveVertices(worldBounds, vertexPositions, delta, *canMoveResult.geometry, uvLock);
+}
+
 bool Brush::canAddVertex(const vm::bbox3& worldBounds, const vm::vec3& position) const {
   ensure(m_geometry != nullptr, "geometry is null");
   if (!worldBounds.contains(position)) {
@@ -542,22 +621,43 @@ static BrushGeometry snappedGeometry(const BrushGeometry& geometry, const FloatT
   return BrushGeometry(std::move(points));
 }
 
+/**
+ * Checks whether all vertices of the given geometry are already on the grid, in which case snapping
+ * does not change the geometry and no convex hull needs to be computed.
+ */
+static bool isSnapped(const BrushGeometry& geometry, const FloatType snapToF) {
+  for (const auto* vertex : geometry.vertices()) {
+    const auto& position = vertex->position();
+    if (snapToF * vm::round(position / snapToF) != position) {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool Brush::canSnapVertices(const vm::bbox3& /* worldBounds */, const FloatType snapToF) const {
   ensure(m_geometry != nullptr, "geometry is null");
-  return snappedGeometry(*m_geometry, snapToF).polyhedron();
+  return isSnapped(*m_geometry, snapToF) || snappedGeometry(*m_geometry, snapToF).polyhedron();
 }
 
 kdl::result<void, BrushError> Brush::snapVertices(
   const vm::bbox3& worldBounds, const FloatType snapToF, const bool uvLock) {
   ensure(m_geometry != nullptr, "geometry is null");
 
+  if (isSnapped(*m_geometry, snapToF)) {
+    return kdl::void_success;
+  }
+
   const BrushGeometry newGeometry = snappedGeometry(*m_geometry, snapToF);
+  const auto newVertexPositions = newGeometry.vertexPositions();
+  const auto newVertexSet =
+    std::set<vm::vec3>(std::begin(newVertexPositions), std::end(newVertexPositions));
 
   std::map<vm::vec3, vm::vec3> vertexMapping;
   for (const auto* vertex : m_geometry->vertices()) {
     const auto& origin = vertex->position();
     const auto destination = snapToF * round(origin / snapToF);
-    if (newGeometry.hasVertex(destination)) {
+    if (newVertexSet.count(destination) > 0) {
       vertexMapping.insert(std::make_pair(origin, destination));
     }
   }
@@ -567,6 +667,12 @@ kdl::result<void, BrushError> Brush::snapVertices(
 }
 
 bool Brush::canMoveEdges(
+  const vm::bbox3& worldBounds, const std::vector<vm::segment3>& edgePositions,
+  const vm::vec3& delta) const {
+  return validateMoveEdges(worldBounds, edgePositions, delta).success;
+}
+
+Brush::CanMoveVerticesResult Brush::validateMoveEdges(
   const vm::bbox3& worldBounds, const std::vector<vm::segment3>& edgePositions,
   const vm::vec3& delta) const {
   ensure(m_geometry != nullptr, "geometry is null");
@@ -575,19 +681,19 @@ bool Brush::canMoveEdges(
   std::vector<vm::vec3> vertexPositions;
   vm::segment3::get_vertices(
     std::begin(edgePositions), std::end(edgePositions), std::back_inserter(vertexPositions));
-  const auto result = doCanMoveVertices(worldBounds, vertexPositions, delta, false);
+  auto result = doCanMoveVertices(worldBounds, vertexPositions, delta, false);
 
   if (!result.success) {
-    return false;
+    return result;
   }
 
   for (const auto& edge : edgePositions) {
     if (!result.geometry->hasEdge(edge.start() + delta, edge.end() + delta)) {
-      return false;
+      return CanMoveVerticesResult::rejectVertexMove();
     }
   }
 
-  return true;
+  return result;
 }
 
 kdl::result<void, BrushError> Brush::moveEdges(
@@ -601,7 +707,26 @@ kdl::result<void, BrushError> Brush::moveEdges(
   return doMoveVertices(worldBounds, vertexPositions, delta, uvLock);
 }
 
+kdl::result<void, BrushError> Brush::moveEdges(
+  const vm::bbox3& worldBounds, const std::vector<vm::segment3>& edgePositions,
+  const vm::vec3& delta, const CanMoveVerticesResult& canMoveResult, const bool uvLock) {
+  if (!canMoveResult.success) {
+    return BrushError::InvalidBrush;
+  }
+
+  std::vector<vm::vec3> vertexPositions;
+  vm::segment3::get_vertices(
+    std::begin(edgePositions), std::end(edgePositions), std::back_inserter(vertexPositions));
+  return doMoveVertices(worldBounds, vertexPositions, delta, *canMoveResult.geometry, uvLock);
+}
+
 bool Brush::canMoveFaces(
+  const vm::bbox3& worldBounds, const std::vector<vm::polygon3>& facePositions,
+  const vm::vec3& delta) const {
+  return validateMoveFaces(worldBounds, facePositions, delta).success;
+}
+
+Brush::CanMoveVerticesResult Brush::validateMoveFaces(
   const vm::bbox3& worldBounds, const std::vector<vm::polygon3>& facePositions,
   const vm::vec3& delta) const {
   ensure(m_geometry != nullptr, "geometry is null");
@@ -610,19 +735,19 @@ bool Brush::canMoveFaces(
   std::vector<vm::vec3> vertexPositions;
   vm::polygon3::get_vertices(
     std::begin(facePositions), std::end(facePositions), std::back_inserter(vertexPositions));
-  const auto result = doCanMoveVertices(worldBounds, vertexPositions, delta, false);
+  auto result = doCanMoveVertices(worldBounds, vertexPositions, delta, false);
 
   if (!result.success) {
-    return false;
+    return result;
   }
 
   for (const auto& face : facePositions) {
     if (!result.geometry->hasFace(face.vertices() + delta)) {
-      return false;
+      return CanMoveVerticesResult::rejectVertexMove();
     }
   }
 
-  return true;
+  return result;
 }
 
 kdl::result<void, BrushError> Brush::moveFaces(
@@ -636,6 +761,19 @@ kdl::result<void, BrushError> Brush::moveFaces(
   return doMoveVertices(worldBounds, vertexPositions, delta, uvLock);
 }
 
+kdl::result<void, BrushError> Brush::moveFaces(
+  const vm::bbox3& worldBounds, const std::vector<vm::polygon3>& facePositions,
+  const vm::vec3& delta, const CanMoveVerticesResult& canMoveResult, const bool uvLock) {
+  if (!canMoveResult.success) {
+    return BrushError::InvalidBrush;
+  }
+
+  std::vector<vm::vec3> vertexPositions;
+  vm::polygon3::get_vertices(
+    std::begin(facePositions), std::end(facePositions), std::back_inserter(vertexPositions));
+  return doMoveVertices(worldBounds, vertexPositions, delta, *canMoveResult.geometry, uvLock);
+}
+
 Brush::CanMoveVerticesResult::CanMoveVerticesResult(const bool s, BrushGeometry&& g)
   : success(s)
   , geometry(std::make_unique<BrushGeometry>(std::move(g))) {}
@@ -695,41 +833,57 @@ Brush::CanMoveVerticesResult Brush::doCanMoveVertices(
   std::vector<vm::vec3> movingPoints;
   movingPoints.reserve(vertexCount());
 
-  std::vector<vm::vec3> resultPoints;
-  resultPoints.reserve(vertexCount());
+  std::vector<vm::vec3> movedPoints;
+  movedPoints.reserve(vertexCount());
 
+  vm::bbox3::builder resultBoundsBuilder;
   for (const auto* vertex : m_geometry->vertices()) {
     const auto& position = vertex->position();
     if (!vertexSet.count(position)) {
       // the vertex is not moving
       remainingPoints.push_back(position);
-      resultPoints.push_back(position);
+      resultBoundsBuilder.add(position);
     } else {
       // the vertex is moving
       movingPoints.push_back(position);
-      resultPoints.push_back(position + delta);
+      movedPoints.push_back(position + delta);
+      resultBoundsBuilder.add(position + delta);
     }
   }
 
-  BrushGeometry remaining(remainingPoints);
-  BrushGeometry moving(movingPoints);
-  BrushGeometry result(resultPoints);
-
-  // Will the result go out of world bounds?
-  if (!worldBounds.contains(result.bounds())) {
+  // Will the result go out of world bounds? The result's vertices are a subset of the given points,
+  // so this can be checked before any convex hull is computed.
+  if (!worldBounds.contains(resultBoundsBuilder.bounds())) {
     return CanMoveVerticesResult::rejectVertexMove();
   }
 
   // Special case, takes care of the first column.
-  if (moving.vertexCount() == vertexCount()) {
-    return CanMoveVerticesResult::acceptVertexMove(std::move(result));
+  if (movingPoints.size() == vertexCount()) {
+    return CanMoveVerticesResult::acceptVertexMove(BrushGeometry(movedPoints));
   }
 
-  // Will vertices be removed?
+  BrushGeometry remaining(remainingPoints);
+
+  // Will vertices be removed? A moved vertex that ends up inside of the remaining fragment can never
+  // be a vertex of the result, unless it coincides with a remaining vertex.
+  if (!allowVertexRemoval) {
+    for (const auto& movedPoint : movedPoints) {
+      if (
+        remaining.contains(movedPoint, vm::constants<FloatType>::point_status_epsilon()) &&
+        !remaining.hasVertex(movedPoint)) {
+        return CanMoveVerticesResult::rejectVertexMove();
+      }
+    }
+  }
+
+  // Only the faces of the remaining fragment which are visible from the moved vertices must be
+  // rebuilt, so there is no need to compute the convex hull of all points from scratch.
+  BrushGeometry result = remaining.extendedBy(movedPoints);
+
   if (!allowVertexRemoval) {
     // All moving vertices must still be present in the result
-    for (const auto& movingVertex : moving.vertexPositions()) {
-      if (!result.hasVertex(movingVertex + delta)) {
+    for (const auto& movedPoint : movedPoints) {
+      if (!result.hasVertex(movedPoint)) {
         return CanMoveVerticesResult::rejectVertexMove();
       }
     }
@@ -740,6 +894,8 @@ Brush::CanMoveVerticesResult Brush::doCanMoveVertices(
     return CanMoveVerticesResult::rejectVertexMove();
   }
 
+  BrushGeometry moving(movingPoints);
+
   // One of the remaining two ok cases?
   if ((moving.point() && remaining.polygon()) || (moving.edge() && remaining.edge())) {
     return CanMoveVerticesResult::acceptVertexMove(std::move(result));
@@ -781,27 +937,29 @@ kdl::result<void, BrushError> Brush::doMoveVertices(
   const bool uvLock) {
   ensure(m_geometry != nullptr, "geometry is null");
   ensure(!vertexPositions.empty(), "no vertex positions");
-  assert(canMoveVertices(worldBounds, vertexPositions, delta));
 
-  std::vector<vm::vec3> newVertices;
-  newVertices.reserve(vertexCount());
-
-  for (const auto* vertex : m_geometry->vertices()) {
-    const auto& position = vertex->position();
-    if (kdl::vec_contains(vertexPositions, position)) {
-      newVertices.push_back(position + delta);
-    } else {
-      newVertices.push_back(position);
-    }
+  // The validity check already computes the new geometry incrementally from the remaining vertices,
+  // so use its result instead of computing the convex hull of all new vertex positions.
+  const auto canMoveResult = doCanMoveVertices(worldBounds, vertexPositions, delta, true);
+  if (!canMoveResult.success) {
+    return BrushError::InvalidBrush;
   }
 
-  BrushGeometry newGeometry(newVertices);
+  return doMoveVertices(worldBounds, vertexPositions, delta, *canMoveResult.geometry, uvLock);
+}
+
+kdl::result<void, BrushError> Brush::doMoveVertices(
+  const vm::bbox3& worldBounds, const std::vector<vm::vec3>& vertexPositions, const vm::vec3& delta,
+  const BrushGeometry& newGeometry, const bool uvLock) {
+  ensure(m_geometry != nullptr, "geometry is null");
+
+  const auto vertexSet = std::set<vm::vec3>(std::begin(vertexPositions), std::end(vertexPositions));
 
   using VecMap = std::map<vm::vec3, vm::vec3>;
   VecMap vertexMapping;
   for (auto* oldVertex : m_geometry->vertices()) {
     const auto& oldPosition = oldVertex->position();
-    const auto moved = kdl::vec_contains(vertexPositions, oldPosition);
+    const auto moved = vertexSet.count(oldPosition) > 0;
     const auto newPosition = moved ? oldPosition + delta : oldPosition;
     const auto* newVertex = newGeometry.findClosestVertex(newPosition, CloseVertexEpsilon);
     if (newVertex != nullptr) {
@@ -936,30 +1094,44 @@ kdl::result<void, BrushError> Brush::updateFacesFromGeometry(
 
 std::vector<kdl::result<Brush, BrushError>> Brush::subtract(
   const MapFormat mapFormat, const vm::bbox3& worldBounds, const std::string& defaultTextureName,
-  const std::vector<const Brush*>& subtrahends) const {
+  const std::vector<const Brush*>& subtrahends, const bool mergeFragments) const {
+  // subtrahends which don't touch this brush neither cut it nor contribute any faces
+  const auto touchingSubtrahends = kdl::vec_filter(subtrahends, [&](const auto* subtrahend) {
+    return bounds().intersects(subtrahend->bounds());
+  });
+
   auto result = std::vector<BrushGeometry>{*m_geometry};
 
-  for (const auto* subtrahend : subtrahends) {
+  for (const auto* subtrahend : touchingSubtrahends) {
     auto nextResults = std::vector<BrushGeometry>{};
 
-    for (const BrushGeometry& fragment : result) {
-      auto subFragments = fragment.subtract(*subtrahend->m_geometry);
-      nextResults = kdl::vec_concat(std::move(nextResults), std::move(subFragments));
+    for (BrushGeometry& fragment : result) {
+      if (fragment.bounds().intersects(subtrahend->bounds())) {
+        auto subFragments = fragment.subtract(*subtrahend->m_geometry);
+        nextResults = kdl::vec_concat(std::move(nextResults), std::move(subFragments));
+      } else {
+        nextResults.push_back(std::move(fragment));
+      }
     }
 
     result = std::move(nextResults);
   }
 
+  if (mergeFragments) {
+    result = BrushGeometry::mergeFragments(std::move(result));
+  }
+
   return kdl::vec_transform(result, [&](const auto& geometry) {
-    return createBrush(mapFormat, worldBounds, defaultTextureName, geometry, subtrahends);
+    return createBrush(mapFormat, worldBounds, defaultTextureName, geometry, touchingSubtrahends);
   });
 }
 
 std::vector<kdl::result<Brush, BrushError>> Brush::subtract(
   const MapFormat mapFormat, const vm::bbox3& worldBounds, const std::string& defaultTextureName,
-  const Brush& subtrahend) const {
+  const Brush& subtrahend, const bool mergeFragments) const {
   return subtract(
-    mapFormat, worldBounds, defaultTextureName, std::vector<const Brush*>{&subtrahend});
+    mapFormat, worldBounds, defaultTextureName, std::vector<const Brush*>{&subtrahend},
+    mergeFragments);
 }
 
 kdl::result<void, BrushError> Brush::intersect(const vm::bbox3& worldBounds, const Brush& brush) {
@@ -41,8 +41,6 @@ enum class MapFormat;
 
 class Brush {
 private:
-  class CopyCallback;
-
   /**
    * Epsilon value to use when finding a vertex after applying a vertex operation
    */
@@ -54,7 +52,23 @@ public:
 
 private:
   std::vector<BrushFace> m_faces;
-  std::unique_ptr<BrushGeometry> m_geometry;
+
+  /**
+   * The geometry is shared between copies of this brush and is never modified once it has been
+   * built. Every change to the geometry replaces it with a newly built one, so copying a brush does
+   * not copy its geometry. The face geometries of the shared geometry are referenced by the faces of
+   * every copy, and their payloads are the face indices, which are the same in every copy. Since
+   * copying a face does not copy its geometry link, the copy constructor links the copied faces to
+   * the shared face geometries using these payloads. The vertex payloads are only used as scratch
+   * space by the renderer.
+   */
+  std::shared_ptr<BrushGeometry> m_geometry;
+
+  /**
+   * Whether any vertex of the geometry has a non-integer coordinate. This is computed once when the
+   * geometry is built and shared between copies along with the geometry.
+   */
+  bool m_hasNonIntegerVertices{false};
 
 public:
   Brush();
@@ -78,6 +92,12 @@ private:
 public:
   const vm::bbox3& bounds() const;
 
+  /**
+   * Returns the number of brushes that share this brush's geometry, including this brush, or 0 if
+   * this brush has no geometry.
+   */
+  size_t geometryShareCount() const;
+
 public: // face management:
   std::optional<size_t> findFace(const std::string& textureName) const;
   std::optional<size_t> findFace(const vm::vec3& normal) const;
@@ -137,6 +157,7 @@ public: // move face along normal
 public:
   // geometry access
   size_t vertexCount() const;
+  bool hasNonIntegerVertices() const;
   const VertexList& vertices() const;
   const std::vector<vm::vec3> vertexPositions() const;
 
@@ -157,13 +178,37 @@ public:
 
   std::vector<const BrushFace*> incidentFaces(const BrushVertex* vertex) const;
 
+  /**
+   * The result of validating a vertex, edge or face move. If the move is valid, it holds the
+   * geometry of the brush after the move. Passing it to the corresponding move function avoids
+   * computing that geometry again, but it must not be used after the brush has changed.
+   */
+  struct CanMoveVerticesResult {
+  public:
+    bool success;
+    std::unique_ptr<BrushGeometry> geometry;
+
+  private:
+    CanMoveVerticesResult(bool s, BrushGeometry&& g);
+
+  public:
+    static CanMoveVerticesResult rejectVertexMove();
+    static CanMoveVerticesResult acceptVertexMove(BrushGeometry&& result);
+  };
+
   // vertex operations
   bool canMoveVertices(
     const vm::bbox3& worldBounds, const std::vector<vm::vec3>& vertices,
     const vm::vec3& delta) const;
+  CanMoveVerticesResult validateMoveVertices(
+    const vm::bbox3& worldBounds, const std::vector<vm::vec3>& vertices,
+    const vm::vec3& delta) const;
   kdl::result<void, BrushError> moveVertices(
     const vm::bbox3& worldBounds, const std::vector<vm::vec3>& vertexPositions,
     const vm::vec3& delta, bool uvLock = false);
+  kdl::result<void, BrushError> moveVertices(
+    const vm::bbox3& worldBounds, const std::vector<vm::vec3>& vertexPositions,
+    const vm::vec3& delta, const CanMoveVerticesResult& canMoveResult, bool uvLock = false);
 
   bool canAddVertex(const vm::bbox3& worldBounds, const vm::vec3& position) const;
   kdl::result<void, BrushError> addVertex(const vm::bbox3& worldBounds, const vm::vec3& position);
@@ -181,38 +226,40 @@ public:
   bool canMoveEdges(
     const vm::bbox3& worldBounds, const std::vector<vm::segment3>& edgePositions,
     const vm::vec3& delta) const;
+  CanMoveVerticesResult validateMoveEdges(
+    const vm::bbox3& worldBounds, const std::vector<vm::segment3>& edgePositions,
+    const vm::vec3& delta) const;
   kdl::result<void, BrushError> moveEdges(
     const vm::bbox3& worldBounds, const std::vector<vm::segment3>& edgePositions,
     const vm::vec3& delta, bool uvLock = false);
+  kdl::result<void, BrushError> moveEdges(
+    const vm::bbox3& worldBounds, const std::vector<vm::segment3>& edgePositions,
+    const vm::vec3& delta, const CanMoveVerticesResult& canMoveResult, bool uvLock = false);
 
   // face operations
   bool canMoveFaces(
     const vm::bbox3& worldBounds, const std::vector<vm::polygon3>& facePositions,
     const vm::vec3& delta) const;
+  CanMoveVerticesResult validateMoveFaces(
+    const vm::bbox3& worldBounds, const std::vector<vm::polygon3>& facePositions,
+    const vm::vec3& delta) const;
   kdl::result<void, BrushError> moveFaces(
     const vm::bbox3& worldBounds, const std::vector<vm::polygon3>& facePositions,
     const vm::vec3& delta, bool uvLock = false);
+  kdl::result<void, BrushError> moveFaces(
+    const vm::bbox3& worldBounds, const std::vector<vm::polygon3>& facePositions,
+    const vm::vec3& delta, const CanMoveVerticesResult& canMoveResult, bool uvLock = false);
 
 private:
-  struct CanMoveVerticesResult {
-  public:
-    bool success;
-    std::unique_ptr<BrushGeometry> geometry;
-
-  private:
-    CanMoveVerticesResult(bool s, BrushGeometry&& g);
-
-  public:
-    static CanMoveVerticesResult rejectVertexMove();
-    static CanMoveVerticesResult acceptVertexMove(BrushGeometry&& result);
-  };
-
   CanMoveVerticesResult doCanMoveVertices(
     const vm::bbox3& worldBounds, const std::vector<vm::vec3>& vertexPositions, vm::vec3 delta,
     bool allowVertexRemoval) const;
   kdl::result<void, BrushError> doMoveVertices(
     const vm::bbox3& worldBounds, const std::vector<vm::vec3>& vertexPositions,
     const vm::vec3& delta, bool lockTexture);
+  kdl::result<void, BrushError> doMoveVertices(
+    const vm::bbox3& worldBounds, const std::vector<vm::vec3>& vertexPositions,
+    const vm::vec3& delta, const BrushGeometry& newGeometry, bool lockTexture);
   /**
    * Tries to find 3 vertices in `left` and `right` that are related according to the
    * PolyhedronMatcher, and generates an affine transform for them which can then be used to
@@ -257,16 +304,18 @@ public:
    * Subtracts the given subtrahends from `this`, returning the result but without modifying `this`.
    *
    * @param subtrahends brushes to subtract from `this`. The passed-in brushes are not modified.
+   * @param mergeFragments whether fragments whose union is convex should be merged, which usually
+   * yields fewer brushes at the cost of a few convex hull computations
    * @return the subtraction result framents as Brushes, or BrushErrors for any fragments which were
    * invalid. Note, the subtraction result should still be usable even if some BrushErrors are
    * returned. It's a hint to the user to double check the result, and potentially report a bug.
    */
   std::vector<kdl::result<Brush, BrushError>> subtract(
     MapFormat mapFormat, const vm::bbox3& worldBounds, const std::string& defaultTextureName,
-    const std::vector<const Brush*>& subtrahends) const;
+    const std::vector<const Brush*>& subtrahends, bool mergeFragments = false) const;
   std::vector<kdl::result<Brush, BrushError>> subtract(
     MapFormat mapFormat, const vm::bbox3& worldBounds, const std::string& defaultTextureName,
-    const Brush& subtrahend) const;
+    const Brush& subtrahend, bool mergeFragments = false) const;
 
   /**
    * Intersects this brush with the given brush.
@@ -25,6 +25,7 @@
 #include <vecmath/vec_io.h>
 
 #include <kdl/opt_utils.h>
+#include <kdl/string_interner.h>
 
 #include <ostream>
 #include <string>
@@ -33,13 +34,19 @@ namespace TrenchBroom {
 namespace Model {
 const std::string BrushFaceAttributes::NoTextureName = "__TB_empty";
 
+namespace {
+const std::string* internTextureName(const std::string_view textureName) {
+  static auto interner = kdl::string_interner{};
+  return &interner.intern(textureName);
+}
+} // namespace
+
 BrushFaceAttributes::BrushFaceAttributes(std::string_view textureName)
-  : m_textureName(textureName)
+  : m_textureName(internTextureName(textureName))
   , m_offset(vm::vec2f::zero())
   , m_scale(vm::vec2f(1.0f, 1.0f))
   , m_rotation(0.0f)
-  , m_bpMode(false)
-  , m_bpMatrix(vm::mat4x4f::identity()) {}
+  , m_bpMode(false) {}
 
 BrushFaceAttributes::BrushFaceAttributes(const BrushFaceAttributes& other)
   : m_textureName(other.m_textureName)
@@ -55,7 +62,7 @@ BrushFaceAttributes::BrushFaceAttributes(const BrushFaceAttributes& other)
 
 BrushFaceAttributes::BrushFaceAttributes(
   std::string_view textureName, const BrushFaceAttributes& other)
-  : m_textureName(textureName)
+  : m_textureName(internTextureName(textureName))
   , m_offset(other.m_offset)
   , m_scale(other.m_scale)
   , m_rotation(other.m_rotation)
@@ -78,7 +85,7 @@ bool operator==(const BrushFaceAttributes& lhs, const BrushFaceAttributes& rhs)
     lhs.m_scale == rhs.m_scale && lhs.m_rotation == rhs.m_rotation &&
     lhs.m_surfaceContents == rhs.m_surfaceContents && lhs.m_surfaceFlags == rhs.m_surfaceFlags &&
     lhs.m_surfaceValue == rhs.m_surfaceValue && lhs.m_color == rhs.m_color &&
-    lhs.m_bpMode == rhs.m_bpMode && lhs.m_bpMatrix == rhs.m_bpMatrix);
+    lhs.m_bpMode == rhs.m_bpMode && lhs.bpMatrix() == rhs.bpMatrix());
 }
 
 /*
@@ -102,7 +109,7 @@ bool operator!=(const BrushFaceAttributes& lhs, const BrushFaceAttributes& rhs)
 
 std::ostream& operator<<(std::ostream& str, const BrushFaceAttributes& attrs) {
   str << "BrushFaceAttributes{"
-      << "textureName: " << attrs.m_textureName << ", "
+      << "textureName: " << *attrs.m_textureName << ", "
       << "offset: " << attrs.m_offset << ", "
       << "scale: " << attrs.m_scale << ", "
       << "rotation: " << attrs.m_rotation << ", "
@@ -128,7 +135,7 @@ void swap(BrushFaceAttributes& lhs, BrushFaceAttributes& rhs) {
 }
 
 const std::string& BrushFaceAttributes::textureName() const {
-  return m_textureName;
+  return *m_textureName;
 }
 
 const vm::vec2f& BrushFaceAttributes::offset() const {
@@ -194,10 +201,10 @@ bool BrushFaceAttributes::valid() const {
 }
 
 bool BrushFaceAttributes::setTextureName(const std::string& textureName) {
-  if (textureName == m_textureName) {
+  if (textureName == *m_textureName) {
     return false;
   } else {
-    m_textureName = textureName;
+    m_textureName = internTextureName(textureName);
     return true;
   }
 }
@@ -302,17 +309,19 @@ bool BrushFaceAttributes::setColor(const std::optional<Color>& color) {
 }
 
 bool BrushFaceAttributes::setBrushPrimitMatrix(const vm::mat4x4f& matrix) {
-  if (matrix == m_bpMatrix) {
+  if (matrix == bpMatrix()) {
     return false;
   } else {
     m_bpMode = true;
-    m_bpMatrix = matrix;
+    m_bpMatrix = matrix == vm::mat4x4f::identity() ? nullptr
+                                                    : std::make_shared<const vm::mat4x4f>(matrix);
     return true;
   }
 }
 
 const vm::mat4x4f& BrushFaceAttributes::bpMatrix() const {
-  return m_bpMatrix;
+  static const auto identity = vm::mat4x4f::identity();
+  return m_bpMatrix ? *m_bpMatrix : identity;
 }
 
 } // namespace Model
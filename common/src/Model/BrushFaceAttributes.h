@@ -25,6 +25,7 @@
 #include <vecmath/mat.h>
 
 #include <iosfwd>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -40,7 +41,8 @@ public:
   static const std::string NoTextureName;
 
 private:
-  std::string m_textureName;
+  // texture names are interned, so faces using the same texture share a single string
+  const std::string* m_textureName;
 
   vm::vec2f m_offset;
   vm::vec2f m_scale;
@@ -54,7 +56,9 @@ private:
 
   // RB: Quake 3 / Doom 3 brush primitives that require the ComputeAxisBase rule for projection
   bool m_bpMode;
-  vm::mat4x4f m_bpMatrix; // usually 2x3 affine transform in 2D space
+  // usually 2x3 affine transform in 2D space; only allocated if it differs from the identity and
+  // shared between copies
+  std::shared_ptr<const vm::mat4x4f> m_bpMatrix;
 
 public:
   explicit BrushFaceAttributes(std::string_view textureName);
@@ -350,15 +350,13 @@ void Entity::updateCachedProperties(const EntityPropertyConfig& propertyConfig)
 }
 
 std::vector<EntityProperty>::const_iterator Entity::findProperty(const std::string& key) const {
-  return std::find_if(std::begin(m_properties), std::end(m_properties), [&](const auto& property) {
-    return property.hasKey(key);
-  });
+  return std::find_if(
+    std::begin(m_properties), std::end(m_properties), EntityPropertyKeyMatcher{key});
 }
 
 std::vector<EntityProperty>::iterator Entity::findProperty(const std::string& key) {
-  return std::find_if(std::begin(m_properties), std::end(m_properties), [&](const auto& property) {
-    return property.hasKey(key);
-  });
+  return std::find_if(
+    std::begin(m_properties), std::end(m_properties), EntityPropertyKeyMatcher{key});
 }
 
 bool operator==(const Entity& lhs, const Entity& rhs) {
@@ -26,6 +26,7 @@
 #include <kdl/string_compare.h>
 #include <kdl/vector_utils.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -413,27 +414,30 @@ bool EntityNodeBase::hasBadModelname() {
 
 std::vector<std::string> EntityNodeBase::findMissingLinkTargets() const {
   std::vector<std::string> result;
-  findMissingTargets(EntityPropertyKeys::Target, result);
+  findMissingTargets(EntityPropertyKeys::Target, m_linkTargets, result);
   return result;
 }
 
 std::vector<std::string> EntityNodeBase::findMissingKillTargets() const {
   std::vector<std::string> result;
-  findMissingTargets(EntityPropertyKeys::Killtarget, result);
+  findMissingTargets(EntityPropertyKeys::Killtarget, m_killTargets, result);
   return result;
 }
 
 void EntityNodeBase::findMissingTargets(
-  const std::string& prefix, std::vector<std::string>& result) const {
+  const std::string& prefix, const std::vector<EntityNodeBase*>& targets,
+  std::vector<std::string>& result) const {
+  // the targets are kept up to date with the targetnames of all entities, so there is no need to
+  // look the targetnames up in the index
   for (const EntityProperty& property : m_entity.numberedProperties(prefix)) {
     const std::string& targetname = property.value();
-    if (targetname.empty()) {
+    if (
+      targetname.empty() ||
+      std::none_of(std::begin(targets), std::end(targets), [&](const auto* target) {
+        const auto* targetTargetname = target->entity().property(EntityPropertyKeys::Targetname);
+        return targetTargetname && *targetTargetname == targetname;
+      })) {
       result.push_back(property.key());
-    } else {
-      std::vector<EntityNodeBase*> linkTargets;
-      findEntityNodesWithProperty(EntityPropertyKeys::Targetname, targetname, linkTargets);
-      if (linkTargets.empty())
-        result.push_back(property.key());
     }
   }
 }
@@ -446,6 +450,7 @@ void EntityNodeBase::addLinks(const std::string& name, const std::string& value)
   } else if (name == EntityPropertyKeys::Targetname) {
     addAllLinkSources(value);
     addAllKillSources(value);
+    invalidateNamesakeIssues(value);
   }
 }
 
@@ -457,6 +462,7 @@ void EntityNodeBase::removeLinks(const std::string& name, const std::string& val
   } else if (name == EntityPropertyKeys::Targetname) {
     removeAllLinkSources();
     removeAllKillSources();
+    invalidateNamesakeIssues(value);
   }
 }
 
@@ -632,6 +638,11 @@ void EntityNodeBase::removeAllLinks() {
   removeAllLinkTargets();
   removeAllKillSources();
   removeAllKillTargets();
+
+  const std::string* targetname = m_entity.property(EntityPropertyKeys::Targetname);
+  if (targetname != nullptr && !targetname->empty()) {
+    invalidateNamesakeIssues(*targetname);
+  }
 }
 
 void EntityNodeBase::addAllLinks() {
@@ -642,6 +653,21 @@ void EntityNodeBase::addAllLinks() {
   if (targetname != nullptr && !targetname->empty()) {
     addAllLinkSources(*targetname);
     addAllKillSources(*targetname);
+    invalidateNamesakeIssues(*targetname);
+  }
+}
+
+void EntityNodeBase::invalidateNamesakeIssues(const std::string& targetname) {
+  // Whether an entity's targetname conflicts with another entity's targetname is not reflected by
+  // the links between the entities, so the other entities must be invalidated explicitly.
+  if (!targetname.empty()) {
+    std::vector<EntityNodeBase*> namesakes;
+    findEntityNodesWithProperty(EntityPropertyKeys::Targetname, targetname, namesakes);
+    for (EntityNodeBase* namesake : namesakes) {
+      if (namesake != this) {
+        namesake->invalidateIssues();
+      }
+    }
   }
 }
 
@@ -124,13 +124,16 @@ public: // link management
   std::vector<std::string> findMissingKillTargets() const;
 
 private: // link management internals
-  void findMissingTargets(const std::string& prefix, std::vector<std::string>& result) const;
+  void findMissingTargets(
+    const std::string& prefix, const std::vector<EntityNodeBase*>& targets,
+    std::vector<std::string>& result) const;
 
   void addLinks(const std::string& name, const std::string& value);
   void removeLinks(const std::string& name, const std::string& value);
   void updateLinks(
     const std::string& oldName, const std::string& oldValue, const std::string& newName,
     const std::string& newValue);
+  void invalidateNamesakeIssues(const std::string& targetname);
 
   void addLinkTargets(const std::string& targetname);
   void addKillTargets(const std::string& targetname);
@@ -23,10 +23,12 @@
 
 #include <kdl/opt_utils.h>
 #include <kdl/string_compare.h>
+#include <kdl/string_interner.h>
 #include <kdl/vector_set.h>
 
 #include <iostream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace TrenchBroom {
@@ -102,21 +104,94 @@ bool isNumberedProperty(std::string_view prefix, std::string_view key) {
   return kdl::cs::str_matches_glob(key, pattern);
 }
 
-EntityProperty::EntityProperty() = default;
+/**
+ * The pool lives until the program exits, so interned property keys are never freed, even if no
+ * property uses them anymore.
+ */
+static kdl::string_interner& propertyKeyInterner() {
+  static auto interner = kdl::string_interner{};
+  return interner;
+}
+
+/**
+ * Maps the address of each of the well-known keys in EntityPropertyKeys to its interned copy. The
+ * map is built once and never modified afterwards, so it can be read without locking the pool.
+ */
+static const std::unordered_map<const std::string*, const std::string*>& wellKnownPropertyKeys() {
+  static const auto result = []() {
+    const auto keys = std::vector<const std::string*>{
+      &EntityPropertyKeys::Classname,
+      &EntityPropertyKeys::Origin,
+      &EntityPropertyKeys::Wad,
+      &EntityPropertyKeys::Textures,
+      &EntityPropertyKeys::Mods,
+      &EntityPropertyKeys::Spawnflags,
+      &EntityPropertyKeys::EntityDefinitions,
+      &EntityPropertyKeys::Angle,
+      &EntityPropertyKeys::Angles,
+      &EntityPropertyKeys::Mangle,
+      &EntityPropertyKeys::Target,
+      &EntityPropertyKeys::Targetname,
+      &EntityPropertyKeys::Model,
+      &EntityPropertyKeys::Killtarget,
+      &EntityPropertyKeys::ProtectedEntityProperties,
+      &EntityPropertyKeys::GroupType,
+      &EntityPropertyKeys::LayerId,
+      &EntityPropertyKeys::LayerName,
+      &EntityPropertyKeys::LayerSortIndex,
+      &EntityPropertyKeys::LayerColor,
+      &EntityPropertyKeys::LayerLocked,
+      &EntityPropertyKeys::LayerHidden,
+      &EntityPropertyKeys::LayerOmitFromExport,
+      &EntityPropertyKeys::Layer,
+      &EntityPropertyKeys::GroupId,
+      &EntityPropertyKeys::GroupName,
+      &EntityPropertyKeys::Group,
+      &EntityPropertyKeys::GroupTransformation,
+      &EntityPropertyKeys::LinkedGroupId,
+      &EntityPropertyKeys::Message,
+      &EntityPropertyKeys::ValveVersion,
+      &EntityPropertyKeys::SoftMapBounds,
+    };
+
+    auto map = std::unordered_map<const std::string*, const std::string*>{};
+    for (const auto* key : keys) {
+      map.emplace(key, &propertyKeyInterner().intern(*key));
+    }
+    return map;
+  }();
+  return result;
+}
+
+static const std::string* findWellKnownPropertyKey(const std::string& key) {
+  const auto& keys = wellKnownPropertyKeys();
+  const auto it = keys.find(&key);
+  return it != keys.end() ? it->second : nullptr;
+}
+
+static const std::string* internPropertyKey(const std::string& key) {
+  if (const auto* internedKey = findWellKnownPropertyKey(key)) {
+    return internedKey;
+  }
+  return &propertyKeyInterner().intern(key);
+}
+
+EntityProperty::EntityProperty()
+  : m_key(&propertyKeyInterner().intern("")) {}
 
 EntityProperty::EntityProperty(const std::string& key, const std::string& value)
-  : m_key(key)
+  : m_key(internPropertyKey(key))
   , m_value(value) {}
 
 int EntityProperty::compare(const EntityProperty& rhs) const {
-  const int keyCmp = m_key.compare(rhs.m_key);
-  if (keyCmp != 0)
-    return keyCmp;
+  if (m_key != rhs.m_key) {
+    return m_key->compare(*rhs.m_key);
+  }
   return m_value.compare(rhs.m_value);
 }
 
 const std::string& EntityProperty::key() const {
-  return m_key;
+  return *m_key;
 }
 
 const std::string& EntityProperty::value() const {
@@ -124,7 +199,7 @@ const std::string& EntityProperty::value() const {
 }
 
 bool EntityProperty::hasKey(std::string_view key) const {
-  return kdl::cs::str_is_equal(m_key, key);
+  return kdl::cs::str_is_equal(*m_key, key);
 }
 
 bool EntityProperty::hasValue(const std::string_view value) const {
@@ -136,7 +211,7 @@ bool EntityProperty::hasKeyAndValue(std::string_view key, std::string_view value
 }
 
 bool EntityProperty::hasPrefix(const std::string_view prefix) const {
-  return kdl::cs::str_is_prefix(m_key, prefix);
+  return kdl::cs::str_is_prefix(*m_key, prefix);
 }
 
 bool EntityProperty::hasPrefixAndValue(
@@ -145,7 +220,7 @@ bool EntityProperty::hasPrefixAndValue(
 }
 
 bool EntityProperty::hasNumberedPrefix(const std::string_view prefix) const {
-  return isNumberedProperty(prefix, m_key);
+  return isNumberedProperty(prefix, *m_key);
 }
 
 bool EntityProperty::hasNumberedPrefixAndValue(
@@ -154,13 +229,21 @@ bool EntityProperty::hasNumberedPrefixAndValue(
 }
 
 void EntityProperty::setKey(const std::string& key) {
-  m_key = key;
+  m_key = internPropertyKey(key);
 }
 
 void EntityProperty::setValue(const std::string& value) {
   m_value = value;
 }
 
+EntityPropertyKeyMatcher::EntityPropertyKeyMatcher(const std::string& key)
+  : m_key(key)
+  , m_internedKey(findWellKnownPropertyKey(key)) {}
+
+bool EntityPropertyKeyMatcher::operator()(const EntityProperty& property) const {
+  return m_internedKey ? &property.key() == m_internedKey : property.key() == m_key;
+}
+
 bool operator<(const EntityProperty& lhs, const EntityProperty& rhs) {
   return lhs.compare(rhs) < 0;
 }
@@ -216,8 +299,9 @@ bool isWorldspawn(
 const std::string& findProperty(
   const std::vector<EntityProperty>& properties, const std::string& key,
   const std::string& defaultValue) {
+  const auto hasKey = EntityPropertyKeyMatcher{key};
   for (const EntityProperty& property : properties) {
-    if (key == property.key()) {
+    if (hasKey(property)) {
       return property.value();
     }
   }
@@ -364,8 +448,9 @@ std::vector<EntityProperty> EntityProperties::numberedProperties(const std::stri
 
 std::vector<EntityProperty>::const_iterator EntityProperties::findProperty(
   const std::string& key) const {
+  const auto hasKey = EntityPropertyKeyMatcher{key};
   for (auto it = std::begin(m_properties), end = std::end(m_properties); it != end; ++it) {
-    if (it->hasKey(key)) {
+    if (hasKey(*it)) {
       return it;
     }
   }
@@ -373,8 +458,9 @@ std::vector<EntityProperty>::const_iterator EntityProperties::findProperty(
 }
 
 std::vector<EntityProperty>::iterator EntityProperties::findProperty(const std::string& key) {
+  const auto hasKey = EntityPropertyKeyMatcher{key};
   for (auto it = std::begin(m_properties), end = std::end(m_properties); it != end; ++it) {
-    if (it->hasKey(key)) {
+    if (hasKey(*it)) {
       return it;
     }
   }
@@ -24,6 +24,7 @@
 #include <iosfwd>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace TrenchBroom {
@@ -90,7 +91,9 @@ bool isNumberedProperty(std::string_view prefix, std::string_view key);
 
 class EntityProperty {
 private:
-  std::string m_key;
+  // interned, so two properties have the same key iff their keys are the same object; interned
+  // keys are never freed
+  const std::string* m_key;
   std::string m_value;
 
 public:
@@ -122,6 +125,25 @@ bool operator==(const EntityProperty& lhs, const EntityProperty& rhs);
 bool operator!=(const EntityProperty& lhs, const EntityProperty& rhs);
 std::ostream& operator<<(std::ostream& str, const EntityProperty& prop);
 
+/**
+ * Checks whether a property has a given key.
+ *
+ * If the given key is one of the constants in EntityPropertyKeys, then its interned copy is known
+ * in advance and the key addresses are compared. Other keys are compared as strings, which is
+ * cheaper than looking them up in the pool of interned keys for the few properties an entity
+ * usually has, and does not require locking the pool.
+ */
+class EntityPropertyKeyMatcher {
+private:
+  const std::string& m_key;
+  const std::string* m_internedKey;
+
+public:
+  explicit EntityPropertyKeyMatcher(const std::string& key);
+
+  bool operator()(const EntityProperty& property) const;
+};
+
 bool isLayer(const std::string& classname, const std::vector<EntityProperty>& properties);
 bool isGroup(const std::string& classname, const std::vector<EntityProperty>& properties);
 bool isWorldspawn(const std::string& classname, const std::vector<EntityProperty>& properties);
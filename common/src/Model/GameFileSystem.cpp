@@ -31,10 +31,12 @@
 #include "Logger.h"
 #include "Model/GameConfig.h"
 
+#include <kdl/parallel.h>
 #include <kdl/string_compare.h>
 #include <kdl/vector_utils.h>
 
 #include <memory>
+#include <string>
 
 namespace TrenchBroom {
 namespace Model {
@@ -123,23 +125,49 @@ void GameFileSystem::addFileSystemPackages(
     auto packages = diskFS.findItems(IO::Path(""), IO::FileExtensionMatcher(packageExtensions));
     packages = kdl::vec_sort(std::move(packages), IO::Path::Less<kdl::ci::string_less>());
 
-    for (const auto& packagePath : packages) {
-      try {
-        if (kdl::ci::str_is_equal(packageFormat, "idpak")) {
-          logger.info() << "Adding file system package " << packagePath;
-          m_next = std::make_shared<IO::IdPakFileSystem>(m_next, diskFS.makeAbsolute(packagePath));
-        } else if (kdl::ci::str_is_equal(packageFormat, "dkpak")) {
-          logger.info() << "Adding file system package " << packagePath;
-          m_next = std::make_shared<IO::DkPakFileSystem>(m_next, diskFS.makeAbsolute(packagePath));
-        } else if (kdl::ci::str_is_equal(packageFormat, "zip")) {
-          logger.info() << "Adding file system package " << packagePath;
-          m_next = std::make_shared<IO::ZipFileSystem>(m_next, diskFS.makeAbsolute(packagePath));
-        }
-      } catch (const std::exception& e) { logger.error() << e.what(); }
+    // Reading the package directories is independent for each package, so we create the
+    // packages in parallel without a next file system and chain them in their original order
+    // afterwards to preserve the override order.
+    struct PackageResult {
+      std::shared_ptr<IO::FileSystem> fileSystem;
+      std::string error;
+    };
+
+    auto absolutePackagePaths = kdl::vec_transform(packages, [&](const IO::Path& packagePath) {
+      return diskFS.makeAbsolute(packagePath);
+    });
+    auto results = kdl::vec_parallel_transform(
+      std::move(absolutePackagePaths), [&](const IO::Path& packagePath) -> PackageResult {
+        try {
+          return {createPackageFileSystem(packageFormat, packagePath), ""};
+        } catch (const std::exception& e) { return {nullptr, e.what()}; }
+      });
+
+    for (size_t i = 0; i < packages.size(); ++i) {
+      auto& [fileSystem, error] = results[i];
+      if (fileSystem) {
+        logger.info() << "Adding file system package " << packages[i];
+        fileSystem->setNext(std::move(m_next));
+        m_next = std::move(fileSystem);
+      } else if (!error.empty()) {
+        logger.error() << error;
+      }
     }
   }
 }
 
+std::shared_ptr<IO::FileSystem> GameFileSystem::createPackageFileSystem(
+  const std::string& packageFormat, const IO::Path& packagePath) {
+  if (kdl::ci::str_is_equal(packageFormat, "idpak")) {
+    return std::make_shared<IO::IdPakFileSystem>(packagePath);
+  } else if (kdl::ci::str_is_equal(packageFormat, "dkpak")) {
+    return std::make_shared<IO::DkPakFileSystem>(packagePath);
+  } else if (kdl::ci::str_is_equal(packageFormat, "zip")) {
+    return std::make_shared<IO::ZipFileSystem>(packagePath);
+  }
+  return nullptr;
+}
+
 void GameFileSystem::addShaderFileSystem(const GameConfig& config, Logger& logger) {
   // To support Quake 3 shaders, we add a shader file system that loads the shaders
   // and makes them available as virtual files.
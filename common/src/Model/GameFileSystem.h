@@ -22,6 +22,7 @@
 #include "IO/FileSystem.h"
 
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace TrenchBroom {
@@ -54,6 +55,8 @@ private:
   void addShaderFileSystem(const GameConfig& config, Logger& logger);
   void addFileSystemPath(const IO::Path& path, Logger& logger);
   void addFileSystemPackages(const GameConfig& config, const IO::Path& searchPath, Logger& logger);
+  static std::shared_ptr<IO::FileSystem> createPackageFileSystem(
+    const std::string& packageFormat, const IO::Path& packagePath);
 
 private:
   bool doDirectoryExists(const IO::Path& path) const override;
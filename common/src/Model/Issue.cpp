@@ -32,6 +32,7 @@
 #include <kdl/overload.h>
 #include <kdl/vector_utils.h>
 
+#include <atomic>
 #include <string>
 
 namespace TrenchBroom {
@@ -94,13 +95,13 @@ void Issue::setHidden(const bool hidden) {
 }
 
 Issue::Issue(Node* node)
-  : m_seqId(nextSeqId())
+  : m_seqId(0)
   , m_node(node) {
   ensure(m_node != nullptr, "node is null");
 }
 
 size_t Issue::nextSeqId() {
-  static size_t seqId = 0;
+  static auto seqId = std::atomic<size_t>{0};
   return seqId++;
 }
 
@@ -32,6 +32,10 @@ class Node;
 
 class Issue {
 private:
+  /**
+   * Assigned by the node when its issues are validated, so that the numbering of issues does not
+   * depend on the order in which they are generated.
+   */
   size_t m_seqId;
 
 protected:
@@ -61,6 +65,8 @@ private: // subclassing interface
   virtual size_t doGetLineNumber() const;
   virtual IssueType doGetType() const = 0;
   virtual std::string doGetDescription() const = 0;
+
+  friend class Node;
 };
 
 class BrushFaceIssue : public Issue {
@@ -47,6 +47,10 @@ const std::vector<IssueQuickFix*>& IssueGenerator::quickFixes() const {
   return m_quickFixes;
 }
 
+void IssueGenerator::prepare() {
+  doPrepare();
+}
+
 void IssueGenerator::generate(WorldNode* worldNode, IssueList& issues) const {
   doGenerate(worldNode, issues);
 }
@@ -77,6 +81,8 @@ void IssueGenerator::addQuickFix(IssueQuickFix* quickFix) {
   m_quickFixes.push_back(quickFix);
 }
 
+void IssueGenerator::doPrepare() {}
+
 void IssueGenerator::doGenerate(WorldNode* worldNode, IssueList& issues) const {
   doGenerate(static_cast<EntityNodeBase*>(worldNode), issues);
 }
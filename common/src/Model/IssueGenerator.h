@@ -52,6 +52,13 @@ public:
   const std::string& description() const;
   const IssueQuickFixList& quickFixes() const;
 
+  /**
+   * Called once before the issues of one or more nodes are generated. Any state that is the same
+   * for all nodes, such as values parsed from the worldspawn entity, should be computed here, since
+   * the generate functions may be called concurrently for different nodes afterwards.
+   */
+  void prepare();
+
   void generate(WorldNode* worldNode, IssueList& issues) const;
   void generate(LayerNode* layerNode, IssueList& issues) const;
   void generate(GroupNode* groupNode, IssueList& issues) const;
@@ -63,6 +70,7 @@ protected:
   void addQuickFix(IssueQuickFix* quickFix);
 
 private:
+  virtual void doPrepare();
   virtual void doGenerate(WorldNode* worldNode, IssueList& issues) const;
   virtual void doGenerate(LayerNode* layerNode, IssueList& issues) const;
   virtual void doGenerate(GroupNode* groupNode, IssueList& issues) const;
@@ -116,6 +116,7 @@ void MissingModIssueGenerator::doGenerate(EntityNodeBase* node, IssueList& issue
   auto game = kdl::mem_lock(m_game);
   const std::vector<std::string> mods = game->extractEnabledMods(node->entity());
 
+  const auto lock = std::lock_guard<std::mutex>{m_lastModsMutex};
   if (mods == m_lastMods) {
     return;
   }
@@ -22,6 +22,7 @@
 #include "Model/IssueGenerator.h"
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -35,6 +36,8 @@ private:
   class MissingModIssueQuickFix;
 
   std::weak_ptr<Game> m_game;
+  // issues may be generated for several nodes concurrently
+  mutable std::mutex m_lastModsMutex;
   mutable std::vector<std::string> m_lastMods;
 
 public:
@@ -19,6 +19,7 @@
 
 #include "ModelUtils.h"
 
+#include "AABBTree.h"
 #include "Ensure.h"
 #include "Model/Brush.h"
 #include "Model/BrushFace.h"
@@ -30,11 +31,14 @@
 #include "Model/LayerNode.h"
 #include "Model/PatchNode.h"
 #include "Model/WorldNode.h"
+#include "ParallelUtils.h"
 #include "Polyhedron.h"
 
 #include <kdl/overload.h>
 #include <kdl/vector_utils.h>
 
+#include <algorithm>
+#include <iterator>
 #include <vector>
 
 namespace TrenchBroom {
@@ -325,19 +329,30 @@ std::vector<Node*> collectNodes(const std::vector<Node*>& nodes) {
  * in the given vector of brushes such that the predicate evaluates to true for that pair of
  * node and brush.
  *
- * The given predicate must be a function that maps a node and a brush to true or false.
+ * The given predicate must be a function that maps a node and a brush to true or false. It must
+ * only match nodes whose logical bounds intersect the logical bounds of the brush. This allows
+ * skipping subtrees which lie outside of all brushes, and finding the brushes to test a node
+ * against using an AABB tree. The remaining candidates are tested in parallel if there are many of
+ * them.
  */
 template <typename P>
 static std::vector<Node*> collectMatchingNodes(
   const std::vector<Node*>& nodes, const std::vector<BrushNode*>& brushes, const P& predicate) {
-  auto result = std::vector<Model::Node*>{};
+  if (brushes.empty()) {
+    return {};
+  }
 
-  const auto collectIfMatching = [&](auto* node) {
-    for (const auto* brush : brushes) {
-      if (predicate(node, brush)) {
-        result.push_back(node);
-        return;
-      }
+  using BrushTree = AABBTree<FloatType, 3, BrushNode*>;
+  auto brushTree = BrushTree{};
+  brushTree.clearAndBuild(brushes, [](const auto* brush) {
+    return brush->logicalBounds();
+  });
+  const auto& brushBounds = brushTree.bounds();
+
+  auto candidates = std::vector<Model::Node*>{};
+  const auto collectIfCandidate = [&](auto* node) {
+    if (node->logicalBounds().intersects(brushBounds)) {
+      candidates.push_back(node);
     }
   };
 
@@ -346,35 +361,55 @@ static std::vector<Node*> collectMatchingNodes(
       [](auto&& thisLambda, Model::WorldNode* world) {
         world->visitChildren(thisLambda);
       },
-      [](auto&& thisLambda, Model::LayerNode* layer) {
-        layer->visitChildren(thisLambda);
+      [&](auto&& thisLambda, Model::LayerNode* layer) {
+        if (layer->logicalBounds().intersects(brushBounds)) {
+          layer->visitChildren(thisLambda);
+        }
       },
       [&](auto&& thisLambda, Model::GroupNode* group) {
         if (group->opened() || group->hasOpenedDescendant()) {
-          group->visitChildren(thisLambda);
+          if (group->logicalBounds().intersects(brushBounds)) {
+            group->visitChildren(thisLambda);
+          }
         } else {
-          collectIfMatching(group);
+          collectIfCandidate(group);
         }
       },
       [&](auto&& thisLambda, Model::EntityNode* entity) {
         if (entity->hasChildren()) {
-          entity->visitChildren(thisLambda);
+          if (entity->logicalBounds().intersects(brushBounds)) {
+            entity->visitChildren(thisLambda);
+          }
         } else {
-          collectIfMatching(entity);
+          collectIfCandidate(entity);
         }
       },
       [&](Model::BrushNode* brush) {
         // if `brush` is one of the search query nodes, don't count it as touching
-        if (!kdl::vec_contains(brushes, brush)) {
-          collectIfMatching(brush);
+        if (!brushTree.contains(brush)) {
+          collectIfCandidate(brush);
         }
       },
       [&](Model::PatchNode* patch) {
         // if `patch` is one of the search query nodes, don't count it as touching
-        collectIfMatching(patch);
+        collectIfCandidate(patch);
       }));
   }
 
+  const auto matches = transformMaybeInParallel(candidates, [&](const auto* node) {
+    auto brushesToTest = std::vector<BrushNode*>{};
+    brushTree.findIntersectors(node->logicalBounds(), std::back_inserter(brushesToTest));
+    return std::any_of(brushesToTest.begin(), brushesToTest.end(), [&](const auto* brush) {
+      return predicate(node, brush);
+    });
+  });
+
+  auto result = std::vector<Model::Node*>{};
+  for (size_t i = 0u; i < candidates.size(); ++i) {
+    if (matches[i]) {
+      result.push_back(candidates[i]);
+    }
+  }
   return result;
 }
 
@@ -429,6 +464,14 @@ std::vector<Node*> collectSelectedNodes(const std::vector<Node*>& nodes) {
   return selectedNodes;
 }
 
+bool isTransformedWithSelection(const Node& node) {
+  return node.transitivelySelected() ||
+         (node.descendantSelected() &&
+          std::all_of(node.children().begin(), node.children().end(), [](const auto* child) {
+            return isTransformedWithSelection(*child);
+          }));
+}
+
 std::vector<Node*> collectSelectableNodes(
   const std::vector<Node*>& nodes, const EditorContext& editorContext) {
   auto result = std::vector<Node*>{};
@@ -79,6 +79,12 @@ std::vector<Node*> collectContainedNodes(
 
 std::vector<Node*> collectSelectedNodes(const std::vector<Node*>& nodes);
 
+/**
+ * Returns whether the given node is transformed as a whole when the selected nodes are transformed,
+ * i.e. whether it is transitively selected or all of its descendants are.
+ */
+bool isTransformedWithSelection(const Node& node);
+
 std::vector<Node*> collectSelectableNodes(
   const std::vector<Node*>& nodes, const EditorContext& editorContext);
 
@@ -27,6 +27,7 @@
 #include "Model/LockState.h"
 #include "Model/VisibilityState.h"
 
+#include <kdl/parallel.h>
 #include <kdl/vector_utils.h>
 
 #include <vecmath/bbox.h>
@@ -734,15 +735,53 @@ void Node::setIssueHidden(const IssueType type, const bool hidden) {
   }
 }
 
+void Node::validateIssues(
+  const std::vector<Node*>& nodes, const std::vector<IssueGenerator*>& issueGenerators) {
+  const auto invalidNodes = kdl::vec_filter(nodes, [](const auto* node) {
+    return !node->m_issuesValid;
+  });
+
+  if (invalidNodes.empty()) {
+    return;
+  }
+
+  for (auto* generator : issueGenerators) {
+    generator->prepare();
+  }
+
+  kdl::parallel_for(invalidNodes.size(), [&](const size_t i) {
+    invalidNodes[i]->generateIssues(issueGenerators);
+  });
+
+  for (auto* node : invalidNodes) {
+    node->numberIssues();
+    node->m_issuesValid = true;
+  }
+}
+
 void Node::validateIssues(const std::vector<IssueGenerator*>& issueGenerators) {
   if (!m_issuesValid) {
-    for (const auto* generator : issueGenerators) {
-      doGenerateIssues(generator, m_issues);
+    for (auto* generator : issueGenerators) {
+      generator->prepare();
     }
+    generateIssues(issueGenerators);
+    numberIssues();
     m_issuesValid = true;
   }
 }
 
+void Node::generateIssues(const std::vector<IssueGenerator*>& issueGenerators) {
+  for (const auto* generator : issueGenerators) {
+    doGenerateIssues(generator, m_issues);
+  }
+}
+
+void Node::numberIssues() {
+  for (auto* issue : m_issues) {
+    issue->m_seqId = Issue::nextSeqId();
+  }
+}
+
 void Node::invalidateIssues() const {
   clearIssues();
   m_issuesValid = false;
@@ -352,6 +352,19 @@ public: // file position
 public: // issue management
   const std::vector<Issue*>& issues(const std::vector<IssueGenerator*>& issueGenerators);
 
+  /**
+   * Validates the issues of the given nodes in parallel. The given issue generators are prepared
+   * once and then called concurrently for different nodes, but never concurrently for the same
+   * node.
+   *
+   * The resulting issues are numbered in the order of the given nodes, so the result is the same as
+   * if the issues of each node had been validated one after the other.
+   *
+   * The given nodes must be distinct.
+   */
+  static void validateIssues(
+    const std::vector<Node*>& nodes, const std::vector<IssueGenerator*>& issueGenerators);
+
   bool issueHidden(IssueType type) const;
   void setIssueHidden(IssueType type, bool hidden);
 
@@ -360,6 +373,8 @@ public: // should only be called from this and from the world
 
 private:
   void validateIssues(const std::vector<IssueGenerator*>& issueGenerators);
+  void generateIssues(const std::vector<IssueGenerator*>& issueGenerators);
+  void numberIssues();
   void clearIssues() const;
 
 public: // visitors
@@ -20,9 +20,14 @@
 #include "NodeContents.h"
 
 #include "Model/BrushFace.h"
+#include "Model/BrushGeometry.h"
+#include "Model/EntityProperties.h"
+#include "Model/Polyhedron.h"
 
 #include <kdl/overload.h>
 
+#include <algorithm>
+
 namespace TrenchBroom {
 namespace Model {
 NodeContents::NodeContents(std::variant<Layer, Group, Entity, Brush, BezierPatch> contents)
@@ -49,5 +54,50 @@ const std::variant<Layer, Group, Entity, Brush, BezierPatch>& NodeContents::get(
 std::variant<Layer, Group, Entity, Brush, BezierPatch>& NodeContents::get() {
   return m_contents;
 }
+
+size_t memoryUsage(const Entity& entity) {
+  auto result = sizeof(Entity) + entity.properties().size() * sizeof(EntityProperty) +
+                entity.protectedProperties().size() * sizeof(std::string);
+  for (const auto& property : entity.properties()) {
+    // property keys are interned
+    result += property.value().capacity();
+  }
+  for (const auto& key : entity.protectedProperties()) {
+    result += key.capacity();
+  }
+  return result;
+}
+
+size_t memoryUsage(const Brush& brush) {
+  // the half edges are not counted by the polyhedron, but there are two of them for each edge
+  const auto geometryUsage = brush.faceCount() * sizeof(BrushFaceGeometry) +
+                             brush.vertexCount() * sizeof(BrushVertex) +
+                             brush.edgeCount() * (sizeof(BrushEdge) + 2u * sizeof(BrushHalfEdge)) +
+                             sizeof(BrushGeometry);
+
+  // the geometry is split among the brushes that share it, so that it is only counted once
+  return sizeof(Brush) + brush.faceCount() * sizeof(BrushFace) +
+         geometryUsage / std::max(brush.geometryShareCount(), size_t(1));
+}
+
+size_t memoryUsage(const BezierPatch& patch) {
+  return sizeof(BezierPatch) + patch.controlPoints().size() * sizeof(BezierPatch::Point) +
+         patch.textureName().capacity();
+}
+
+size_t memoryUsage(const NodeContents& contents) {
+  return std::visit(
+    kdl::overload(
+      [](const Layer& layer) {
+        return sizeof(NodeContents) + layer.name().capacity();
+      },
+      [](const Group& group) {
+        return sizeof(NodeContents) + group.name().capacity();
+      },
+      [](const auto& object) {
+        return sizeof(NodeContents) - sizeof(object) + memoryUsage(object);
+      }),
+    contents.get());
+}
 } // namespace Model
 } // namespace TrenchBroom
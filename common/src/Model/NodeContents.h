@@ -25,6 +25,7 @@
 #include "Model/Group.h"
 #include "Model/Layer.h"
 
+#include <cstddef>
 #include <variant>
 
 namespace TrenchBroom {
@@ -43,5 +44,18 @@ public:
   const std::variant<Layer, Group, Entity, Brush, BezierPatch>& get() const;
   std::variant<Layer, Group, Entity, Brush, BezierPatch>& get();
 };
+
+/**
+ * Returns an estimate of the number of bytes used by the given object, including the memory it owns
+ * on the heap, such as entity properties or brush faces and brush geometry.
+ *
+ * Memory that is shared between objects, such as interned strings, is not accounted for. Brush
+ * geometry that is shared between several brushes is split evenly among them, so that the total
+ * over all brushes counts it only once.
+ */
+size_t memoryUsage(const Entity& entity);
+size_t memoryUsage(const Brush& brush);
+size_t memoryUsage(const BezierPatch& patch);
+size_t memoryUsage(const NodeContents& contents);
 } // namespace Model
 } // namespace TrenchBroom
@@ -0,0 +1,111 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "NodeContentsDelta.h"
+
+#include "Ensure.h"
+#include "Model/Brush.h"
+#include "Model/BrushNode.h"
+
+#include <kdl/overload.h>
+
+namespace TrenchBroom {
+namespace Model {
+NodeContentsDelta::NodeContentsDelta(std::variant<NodeContents, BrushFaceDelta> delta)
+  : m_delta(std::move(delta)) {}
+
+NodeContentsDelta NodeContentsDelta::create(const Node& base, NodeContents contents) {
+  const auto* brushNode = dynamic_cast<const BrushNode*>(&base);
+  return create(brushNode ? &brushNode->brush() : nullptr, std::move(contents));
+}
+
+NodeContentsDelta NodeContentsDelta::create(const NodeContents& base, NodeContents contents) {
+  return create(std::get_if<Brush>(&base.get()), std::move(contents));
+}
+
+NodeContentsDelta NodeContentsDelta::create(const Brush* base, NodeContents contents) {
+  const auto* brush = std::get_if<Brush>(&contents.get());
+  if (!base || !brush || base->faceCount() != brush->faceCount()) {
+    return NodeContentsDelta{std::move(contents)};
+  }
+
+  auto changedFaces = std::vector<std::pair<size_t, BrushFace>>{};
+  for (size_t i = 0u; i < brush->faceCount(); ++i) {
+    const auto& baseFace = base->face(i);
+    const auto& face = brush->face(i);
+    // brushes share their face geometries iff they share their geometry
+    if (face.geometry() != baseFace.geometry()) {
+      return NodeContentsDelta{std::move(contents)};
+    }
+    if (face != baseFace) {
+      changedFaces.emplace_back(i, face);
+    }
+  }
+
+  return NodeContentsDelta{BrushFaceDelta{std::move(changedFaces)}};
+}
+
+NodeContents NodeContentsDelta::apply(const Node& base) && {
+  const auto* brushNode = dynamic_cast<const BrushNode*>(&base);
+  return std::move(*this).apply(brushNode ? &brushNode->brush() : nullptr);
+}
+
+NodeContents NodeContentsDelta::apply(const NodeContents& base) && {
+  return std::move(*this).apply(std::get_if<Brush>(&base.get()));
+}
+
+NodeContents NodeContentsDelta::apply(const Brush* base) && {
+  return std::visit(
+    kdl::overload(
+      [](NodeContents&& contents) {
+        return std::move(contents);
+      },
+      [&](BrushFaceDelta&& delta) {
+        ensure(base != nullptr, "base is not a brush");
+
+        auto brush = *base;
+        for (auto& [index, face] : delta.changedFaces) {
+          // the stored faces are copies, which are not linked to any geometry
+          auto* faceGeometry = base->face(index).geometry();
+          brush.face(index) = std::move(face);
+          brush.face(index).setGeometry(faceGeometry);
+        }
+        return NodeContents{std::move(brush)};
+      }),
+    std::move(m_delta));
+}
+
+bool NodeContentsDelta::isDelta() const {
+  return std::holds_alternative<BrushFaceDelta>(m_delta);
+}
+
+size_t NodeContentsDelta::memoryUsage() const {
+  return std::visit(
+    kdl::overload(
+      [](const NodeContents& contents) {
+        return sizeof(NodeContentsDelta) - sizeof(NodeContents) + Model::memoryUsage(contents);
+      },
+      [](const BrushFaceDelta& delta) {
+        return sizeof(NodeContentsDelta) +
+               delta.changedFaces.size() * sizeof(std::pair<size_t, BrushFace>);
+      }),
+    m_delta);
+}
+} // namespace Model
+} // namespace TrenchBroom
@@ -0,0 +1,92 @@
+/*
+ Copyright (C) 2020 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "Model/BrushFace.h"
+#include "Model/NodeContents.h"
+
+#include <cstddef>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace TrenchBroom {
+namespace Model {
+class Node;
+
+/**
+ * Stores node contents compactly relative to other contents, called the base, which is usually the
+ * current contents of a node.
+ *
+ * If the contents are a brush that shares its geometry with the base brush, then only the faces
+ * that differ from the faces of the base brush are stored. This is the case if only the face
+ * attributes were changed. All other contents are stored in full.
+ *
+ * To restore the contents, the delta must be applied to the same base contents that it was created
+ * from.
+ */
+class NodeContentsDelta {
+private:
+  struct BrushFaceDelta {
+    std::vector<std::pair<size_t, BrushFace>> changedFaces;
+  };
+
+  std::variant<NodeContents, BrushFaceDelta> m_delta;
+
+public:
+  /**
+   * Creates a delta that stores the given contents relative to the current contents of the given
+   * node.
+   */
+  static NodeContentsDelta create(const Node& base, NodeContents contents);
+
+  /**
+   * Creates a delta that stores the given contents relative to the given base contents.
+   */
+  static NodeContentsDelta create(const NodeContents& base, NodeContents contents);
+
+  /**
+   * Restores the contents from this delta and the current contents of the given node.
+   */
+  NodeContents apply(const Node& base) &&;
+
+  /**
+   * Restores the contents from this delta and the given base contents.
+   */
+  NodeContents apply(const NodeContents& base) &&;
+
+  /**
+   * Indicates whether the contents are stored as a delta or in full.
+   */
+  bool isDelta() const;
+
+  /**
+   * Returns an estimate of the number of bytes used by this delta.
+   */
+  size_t memoryUsage() const;
+
+private:
+  explicit NodeContentsDelta(std::variant<NodeContents, BrushFaceDelta> delta);
+
+  static NodeContentsDelta create(const Brush* base, NodeContents contents);
+  NodeContents apply(const Brush* base) &&;
+};
+} // namespace Model
+} // namespace TrenchBroom
@@ -19,12 +19,10 @@
 
 #include "NonIntegerVerticesIssueGenerator.h"
 
-#include "Model/BrushGeometry.h"
 #include "Model/BrushNode.h"
 #include "Model/Issue.h"
 #include "Model/IssueQuickFix.h"
 #include "Model/MapFacade.h"
-#include "Polyhedron.h"
 
 #include <string>
 
@@ -65,12 +63,8 @@ NonIntegerVerticesIssueGenerator::NonIntegerVerticesIssueGenerator()
 }
 
 void NonIntegerVerticesIssueGenerator::doGenerate(BrushNode* brushNode, IssueList& issues) const {
-  const Brush& brush = brushNode->brush();
-  for (const BrushVertex* vertex : brush.vertices()) {
-    if (!vm::is_integral(vertex->position())) {
-      issues.push_back(new NonIntegerVerticesIssue(brushNode));
-      return;
-    }
+  if (brushNode->brush().hasNonIntegerVertices()) {
+    issues.push_back(new NonIntegerVerticesIssue(brushNode));
   }
 }
 } // namespace Model
@@ -29,6 +29,7 @@
 #include <vecmath/util.h>
 #include <vecmath/vec.h>
 
+#include <cstddef>
 #include <initializer_list>
 #include <limits>
 #include <optional>
@@ -105,6 +106,17 @@ private:
   explicit Polyhedron_Vertex(const vm::vec<T, 3>& position);
 
 public:
+  /**
+   * Allocates memory for a new instance from a pool. Polyhedra are created, copied and destroyed
+   * frequently, so their vertices are pooled to avoid the cost of many small heap allocations.
+   */
+  static void* operator new(std::size_t size);
+
+  /**
+   * Returns the memory of the given instance to the pool.
+   */
+  static void operator delete(void* ptr) noexcept;
+
   /**
    * Returns the position of this vertex.
    */
@@ -245,6 +257,17 @@ private:
   Polyhedron_Edge(HalfEdge* first, HalfEdge* second = nullptr);
 
 public:
+  /**
+   * Allocates memory for a new instance from a pool. Polyhedra are created, copied and destroyed
+   * frequently, so their edges are pooled to avoid the cost of many small heap allocations.
+   */
+  static void* operator new(std::size_t size);
+
+  /**
+   * Returns the memory of the given instance to the pool.
+   */
+  static void operator delete(void* ptr) noexcept;
+
   /**
    * Returns the origin of the first half edge.
    */
@@ -541,6 +564,17 @@ private:
   Polyhedron_HalfEdge(Vertex* origin);
 
 public:
+  /**
+   * Allocates memory for a new instance from a pool. Polyhedra are created, copied and destroyed
+   * frequently, so their half edges are pooled to avoid the cost of many small heap allocations.
+   */
+  static void* operator new(std::size_t size);
+
+  /**
+   * Returns the memory of the given instance to the pool.
+   */
+  static void operator delete(void* ptr) noexcept;
+
   /**
    * Returns the origin vertex of this half edge.
    */
@@ -758,6 +792,17 @@ private:
   explicit Polyhedron_Face(HalfEdgeList&& boundary, const vm::plane<T, 3>& plane);
 
 public:
+  /**
+   * Allocates memory for a new instance from a pool. Polyhedra are created, copied and destroyed
+   * frequently, so their faces are pooled to avoid the cost of many small heap allocations.
+   */
+  static void* operator new(std::size_t size);
+
+  /**
+   * Returns the memory of the given instance to the pool.
+   */
+  static void operator delete(void* ptr) noexcept;
+
   /**
    * Returns the circular list of half edges that make up the boundary of this face.
    */
@@ -1604,6 +1649,21 @@ public:
   std::string exportObjSelectedFaces(const std::vector<const Face*>& faces) const;
 
   /* ====================== Implementation in Polyhedron_ConvexHull.h ====================== */
+public: // Convex hull; incremental updates
+  /**
+   * Returns the convex hull of this polyhedron's vertices and the given points.
+   *
+   * The result is computed by adding the given points to a copy of this polyhedron, so only the
+   * faces which are visible from the added points are replaced. If this polyhedron is already
+   * known, this is much cheaper than computing the convex hull of all points from scratch. The
+   * plane epsilon is derived from the bounds of all points, so the same tolerances apply as if the
+   * convex hull were computed from scratch.
+   *
+   * @param points the points to add
+   * @return the convex hull of this polyhedron's vertices and the given points
+   */
+  Polyhedron extendedBy(std::vector<vm::vec<T, 3>> points) const;
+
 private: // Convex hull; adding and removing points
   /**
    * Adds the given points to this polyhedron. The effect of adding the given points to a polyhedron
@@ -2136,6 +2196,34 @@ private:
    */
   HalfEdge* findNextIntersectingEdge(HalfEdge* searchFrom, const vm::plane<T, 3>& plane) const;
 
+  /* ====================== Implementation in Polyhedron_Planes.h ====================== */
+public: // Construction from planes
+  /**
+   * Constructs the convex polyhedron bounded by the given planes by intersecting them directly.
+   *
+   * This is a fast alternative to clipping a cube with each of the given planes which only handles
+   * the common case of a simple polyhedron, i.e. one where each vertex lies on exactly three of the
+   * given planes. Each vertex is computed as the intersection point of three planes and the half
+   * edge structure is built from the resulting vertices without any intermediate clipping steps.
+   *
+   * If the given planes do not bound a simple polyhedron that is contained in the given bounds, an
+   * empty optional is returned and the caller must fall back to clipping. In particular, this is
+   * the case if a vertex lies on more than three planes, if the planes do not bound a closed
+   * polyhedron, or if the polyhedron is empty.
+   *
+   * A plane that does not touch the resulting polyhedron does not produce a face, just like
+   * clipping with such a plane does not change the polyhedron.
+   *
+   * @param planes the planes to intersect, the normals of which must point outwards
+   * @param bounds the bounds which must contain the resulting polyhedron
+   * @param faces receives, for each of the given planes, the face that lies on that plane or null
+   * if the plane does not produce a face
+   * @return the resulting polyhedron or an empty optional if it could not be constructed
+   */
+  static std::optional<Polyhedron> fromPlanes(
+    const std::vector<vm::plane<T, 3>>& planes, const vm::bbox<T, 3>& bounds,
+    std::vector<Face*>& faces);
+
   /* ====================== Implementation in Polyhedron_CSG.h ====================== */
 public: // Intersection
   /**
@@ -2164,9 +2252,24 @@ public: // Subtraction
    */
   std::vector<Polyhedron> subtract(const Polyhedron& subtrahend) const;
 
+  /**
+   * Merges the given fragments into fewer convex polyhedra. The fragments must be convex polyhedra
+   * whose interiors are pairwise disjoint, e.g. the result of a subtraction.
+   *
+   * Two fragments are merged if their union is convex, which is the case if the convex hull of
+   * their vertices has the same volume as both fragments together. Fragments are merged greedily,
+   * so the result is not guaranteed to be minimal.
+   *
+   * @param fragments the fragments to merge
+   * @return the merged fragments
+   */
+  static std::vector<Polyhedron> mergeFragments(std::vector<Polyhedron> fragments);
+
 private:
   class Subtract;
 
+  static std::optional<Polyhedron> mergeFragmentPair(const Polyhedron& lhs, const Polyhedron& rhs);
+
   /* ====================== Implementation in Polyhedron_Queries.h ====================== */
 public: // geometrical queries
   /**
@@ -2198,6 +2301,11 @@ public: // geometrical queries
    */
   bool intersects(const Polyhedron& other) const;
 
+  /**
+   * Returns the volume of this polyhedron, or 0 if this polyhedron is not a convex volume.
+   */
+  T volume() const;
+
 private: // helper functions for all cases of polygon / polygon intersection
   static bool pointIntersectsPoint(const Polyhedron& lhs, const Polyhedron& rhs);
   static bool pointIntersectsEdge(const Polyhedron& lhs, const Polyhedron& rhs);
@@ -21,6 +21,11 @@
 
 #include "Polyhedron.h"
 
+#include <vecmath/constants.h>
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
 #include <vector>
 
 namespace TrenchBroom {
@@ -49,6 +54,47 @@ std::vector<Polyhedron<T, FP, VP>> Polyhedron<T, FP, VP>::subtract(
   return subtract.result();
 }
 
+template <typename T, typename FP, typename VP>
+std::vector<Polyhedron<T, FP, VP>> Polyhedron<T, FP, VP>::mergeFragments(
+  std::vector<Polyhedron> fragments) {
+  for (size_t i = 0u; i < fragments.size(); ++i) {
+    for (size_t j = i + 1u; j < fragments.size();) {
+      if (auto merged = mergeFragmentPair(fragments[i], fragments[j])) {
+        fragments[i] = std::move(*merged);
+        fragments.erase(std::next(std::begin(fragments), static_cast<std::ptrdiff_t>(j)));
+
+        // the merged fragment may now be mergeable with a fragment that was skipped before
+        j = i + 1u;
+      } else {
+        ++j;
+      }
+    }
+  }
+
+  return fragments;
+}
+
+template <typename T, typename FP, typename VP>
+std::optional<Polyhedron<T, FP, VP>> Polyhedron<T, FP, VP>::mergeFragmentPair(
+  const Polyhedron& lhs, const Polyhedron& rhs) {
+  if (!lhs.polyhedron() || !rhs.polyhedron() || !lhs.bounds().intersects(rhs.bounds())) {
+    return std::nullopt;
+  }
+
+  auto positions = lhs.vertexPositions();
+  const auto rhsPositions = rhs.vertexPositions();
+  positions.insert(std::end(positions), std::begin(rhsPositions), std::end(rhsPositions));
+
+  // the fragments don't overlap, so their union is convex iff it fills their convex hull
+  auto hull = Polyhedron(std::move(positions));
+  const auto volumeDifference = hull.volume() - lhs.volume() - rhs.volume();
+  if (volumeDifference > vm::constants<T>::almost_zero()) {
+    return std::nullopt;
+  }
+
+  return hull;
+}
+
 template <typename T, typename FP, typename VP> class Polyhedron<T, FP, VP>::Subtract {
 private:
   const Polyhedron& m_minuend;
@@ -37,10 +37,8 @@
 
 namespace TrenchBroom {
 namespace Model {
-template <typename T> static T computePlaneEpsilon(const std::vector<vm::vec<T, 3>>& points) {
-  typename vm::bbox<T, 3>::builder builder;
-  builder.add(std::begin(points), std::end(points));
-  const auto size = builder.bounds().size();
+template <typename T> static T computePlaneEpsilon(const vm::bbox<T, 3>& bounds) {
+  const auto size = bounds.size();
 
   const auto defaultEpsilon = vm::constants<T>::point_status_epsilon();
   const auto computedEpsilon =
@@ -48,12 +46,35 @@ template <typename T> static T computePlaneEpsilon(const std::vector<vm::vec<T,
   return std::max(computedEpsilon, defaultEpsilon);
 }
 
+template <typename T> static vm::bbox<T, 3> computeBounds(const std::vector<vm::vec<T, 3>>& points) {
+  typename vm::bbox<T, 3>::builder builder;
+  builder.add(std::begin(points), std::end(points));
+  return builder.bounds();
+}
+
+template <typename T, typename FP, typename VP>
+Polyhedron<T, FP, VP> Polyhedron<T, FP, VP>::extendedBy(std::vector<vm::vec<T, 3>> points) const {
+  auto result = *this;
+  if (!points.empty()) {
+    points = kdl::vec_sort_and_remove_duplicates(std::move(points));
+
+    // use the same epsilon that would be used if the hull were built from all points at once
+    const auto pointBounds = computeBounds(points);
+    const auto planeEpsilon =
+      computePlaneEpsilon(empty() ? pointBounds : vm::merge(bounds(), pointBounds));
+    for (const auto& point : points) {
+      result.addPoint(point, planeEpsilon);
+    }
+  }
+  return result;
+}
+
 template <typename T, typename FP, typename VP>
 void Polyhedron<T, FP, VP>::addPoints(std::vector<vm::vec<T, 3>> points) {
   if (!points.empty()) {
     points = kdl::vec_sort_and_remove_duplicates(std::move(points));
 
-    const auto planeEpsilon = computePlaneEpsilon(points);
+    const auto planeEpsilon = computePlaneEpsilon(computeBounds(points));
     for (const auto& point : points) {
       addPoint(point, planeEpsilon);
     }
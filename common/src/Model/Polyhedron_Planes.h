@@ -0,0 +1,208 @@
+/*
+ Copyright (C) 2010-2017 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "Polyhedron.h"
+
+#include <vecmath/bbox.h>
+#include <vecmath/plane.h>
+#include <vecmath/scalar.h>
+#include <vecmath/vec.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace TrenchBroom {
+namespace Model {
+template <typename T, typename FP, typename VP>
+std::optional<Polyhedron<T, FP, VP>> Polyhedron<T, FP, VP>::fromPlanes(
+  const std::vector<vm::plane<T, 3>>& planes, const vm::bbox<T, 3>& bounds,
+  std::vector<Face*>& faces) {
+  const auto epsilon = vm::constants<T>::point_status_epsilon();
+  const auto innerBounds = vm::bbox<T, 3>{
+    bounds.min + vm::vec<T, 3>::fill(epsilon), bounds.max - vm::vec<T, 3>::fill(epsilon)};
+
+  struct PlaneVertex {
+    vm::vec<T, 3> position;
+    std::array<size_t, 3> planeIndices;
+  };
+
+  // Find the vertices by intersecting every triple of planes. Every intersection point that is not
+  // above any plane is a vertex, and every vertex must lie on exactly three planes.
+  auto vertices = std::vector<PlaneVertex>{};
+  for (size_t i = 0u; i < planes.size(); ++i) {
+    const auto& p1 = planes[i];
+    for (size_t j = i + 1u; j < planes.size(); ++j) {
+      const auto& p2 = planes[j];
+      const auto n1xn2 = vm::cross(p1.normal, p2.normal);
+      for (size_t k = j + 1u; k < planes.size(); ++k) {
+        const auto& p3 = planes[k];
+        const auto denominator = vm::dot(p3.normal, n1xn2);
+        if (vm::is_zero(denominator, vm::constants<T>::almost_zero())) {
+          continue;
+        }
+
+        const auto position = (p1.distance * vm::cross(p2.normal, p3.normal) +
+                               p2.distance * vm::cross(p3.normal, p1.normal) +
+                               p3.distance * n1xn2) /
+                              denominator;
+
+        auto inside = size_t(0);
+        auto above = false;
+        for (const auto& plane : planes) {
+          const auto distance = plane.point_distance(position);
+          if (distance > epsilon) {
+            above = true;
+            break;
+          }
+          if (distance >= -epsilon) {
+            ++inside;
+          }
+        }
+
+        if (above) {
+          continue;
+        }
+        if (inside != 3u || !innerBounds.contains(position)) {
+          return std::nullopt;
+        }
+
+        vertices.push_back({position, {i, j, k}});
+      }
+    }
+  }
+
+  if (vertices.size() < 4u) {
+    return std::nullopt;
+  }
+
+  // Collect the vertices on each plane.
+  auto planeVertices = std::vector<std::vector<size_t>>(planes.size());
+  for (size_t i = 0u; i < vertices.size(); ++i) {
+    for (const auto planeIndex : vertices[i].planeIndices) {
+      planeVertices[planeIndex].push_back(i);
+    }
+  }
+
+  auto result = Polyhedron{};
+
+  auto newVertices = std::vector<Vertex*>{};
+  newVertices.reserve(vertices.size());
+  for (const auto& vertex : vertices) {
+    auto* newVertex = new Vertex(vertex.position);
+    result.m_vertices.push_back(newVertex);
+    newVertices.push_back(newVertex);
+  }
+
+  // Build the faces. The boundary of every face is sorted counter clockwise when viewed from
+  // above. Since each vertex lies on exactly three faces, it has exactly three leaving half edges,
+  // and we remember each of them along with its destination.
+  using LeavingHalfEdge = std::pair<size_t, HalfEdge*>;
+  auto leavingHalfEdges = std::vector<std::vector<LeavingHalfEdge>>(vertices.size());
+
+  faces.assign(planes.size(), nullptr);
+  for (size_t i = 0u; i < planes.size(); ++i) {
+    auto& indices = planeVertices[i];
+    if (indices.empty()) {
+      // the plane does not touch the polyhedron
+      continue;
+    }
+    if (indices.size() < 3u) {
+      return std::nullopt;
+    }
+
+    const auto& normal = planes[i].normal;
+    auto center = vm::vec<T, 3>::zero();
+    for (const auto index : indices) {
+      center = center + vertices[index].position;
+    }
+    center = center / static_cast<T>(indices.size());
+
+    const auto u = vm::normalize(vertices[indices.front()].position - center);
+    const auto v = vm::cross(normal, u);
+    auto angles = std::vector<std::pair<T, size_t>>{};
+    angles.reserve(indices.size());
+    for (const auto index : indices) {
+      const auto d = vertices[index].position - center;
+      angles.emplace_back(std::atan2(vm::dot(d, v), vm::dot(d, u)), index);
+    }
+    std::sort(angles.begin(), angles.end());
+
+    auto boundary = HalfEdgeList{};
+    for (size_t j = 0u; j < angles.size(); ++j) {
+      const auto origin = angles[j].second;
+      const auto destination = angles[(j + 1u) % angles.size()].second;
+
+      auto* halfEdge = new HalfEdge(newVertices[origin]);
+      boundary.push_back(halfEdge);
+      leavingHalfEdges[origin].emplace_back(destination, halfEdge);
+    }
+
+    auto* face = new Face(std::move(boundary), planes[i]);
+    result.m_faces.push_back(face);
+    faces[i] = face;
+  }
+
+  // Connect each pair of twin half edges with an edge.
+  const auto findLeavingHalfEdge = [&](const size_t origin, const size_t destination) {
+    for (const auto& [d, halfEdge] : leavingHalfEdges[origin]) {
+      if (d == destination) {
+        return halfEdge;
+      }
+    }
+    return static_cast<HalfEdge*>(nullptr);
+  };
+
+  auto halfEdgeCount = size_t(0);
+  for (size_t origin = 0u; origin < leavingHalfEdges.size(); ++origin) {
+    if (leavingHalfEdges[origin].size() != 3u) {
+      return std::nullopt;
+    }
+    halfEdgeCount += leavingHalfEdges[origin].size();
+
+    for (const auto& [destination, halfEdge] : leavingHalfEdges[origin]) {
+      if (origin < destination) {
+        auto* twin = findLeavingHalfEdge(destination, origin);
+        if (twin == nullptr || twin->edge() != nullptr) {
+          return std::nullopt;
+        }
+        result.m_edges.push_back(new Edge(halfEdge, twin));
+      }
+    }
+  }
+
+  // Every half edge must have a twin, and the result must be a closed polyhedron.
+  if (
+    2u * result.m_edges.size() != halfEdgeCount ||
+    result.m_vertices.size() + result.m_faces.size() != result.m_edges.size() + 2u) {
+    return std::nullopt;
+  }
+
+  result.updateBounds();
+  assert(result.checkInvariant());
+
+  return result;
+}
+} // namespace Model
+} // namespace TrenchBroom
@@ -68,6 +68,28 @@ bool Polyhedron<T, FP, VP>::contains(const Polyhedron& other) const {
   return true;
 }
 
+template <typename T, typename FP, typename VP> T Polyhedron<T, FP, VP>::volume() const {
+  if (!polyhedron()) {
+    return static_cast<T>(0);
+  }
+
+  // Sum the signed volumes of the tetrahedra spanned by a fixed vertex and a fan triangulation of
+  // each face. Using a vertex of this polyhedron as the apex avoids cancellation errors for
+  // polyhedra that are far from the origin.
+  const auto& origin = m_vertices.front()->position();
+
+  auto result = static_cast<T>(0);
+  for (const Face* face : m_faces) {
+    const auto positions = face->vertexPositions();
+    const auto p0 = positions[0] - origin;
+    for (size_t i = 1u; i + 1u < positions.size(); ++i) {
+      result += vm::dot(p0, vm::cross(positions[i] - origin, positions[i + 1u] - origin));
+    }
+  }
+
+  return vm::abs(result) / static_cast<T>(6);
+}
+
 template <typename T, typename FP, typename VP>
 bool Polyhedron<T, FP, VP>::intersects(const Polyhedron& other) const {
   if (!bounds().intersects(other.bounds())) {
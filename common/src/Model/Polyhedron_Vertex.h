@@ -19,9 +19,13 @@
 
 #pragma once
 
+#include "Macros.h"
 #include "Polyhedron.h"
 
 #include <kdl/intrusive_circular_list.h>
+#include <kdl/slab_pool.h>
+
+#include <cassert>
 
 namespace TrenchBroom {
 namespace Model {
@@ -57,6 +61,18 @@ Polyhedron_Vertex<T, FP, VP>::Polyhedron_Vertex(const vm::vec<T, 3>& position)
   m_payload(VP::defaultValue()) {
 }
 
+template <typename T, typename FP, typename VP>
+void* Polyhedron_Vertex<T, FP, VP>::operator new(const std::size_t size) {
+  assert(size == sizeof(Polyhedron_Vertex));
+  unused(size);
+  return kdl::slab_pool<Polyhedron_Vertex>::allocate();
+}
+
+template <typename T, typename FP, typename VP>
+void Polyhedron_Vertex<T, FP, VP>::operator delete(void* ptr) noexcept {
+  kdl::slab_pool<Polyhedron_Vertex>::deallocate(ptr);
+}
+
 template <typename T, typename FP, typename VP>
 const vm::vec<T, 3>& Polyhedron_Vertex<T, FP, VP>::position() const {
   return m_position;
@@ -70,14 +70,16 @@ SoftMapBoundsIssueGenerator::SoftMapBoundsIssueGenerator(
   addQuickFix(new SoftMapBoundsIssueQuickFix());
 }
 
-void SoftMapBoundsIssueGenerator::generateInternal(Node* node, IssueList& issues) const {
+void SoftMapBoundsIssueGenerator::doPrepare() {
   auto game = kdl::mem_lock(m_game);
-  const Game::SoftMapBounds bounds = game->extractSoftMapBounds(m_world->entity());
+  m_softMapBounds = game->extractSoftMapBounds(m_world->entity()).bounds;
+}
 
-  if (!bounds.bounds.has_value()) {
+void SoftMapBoundsIssueGenerator::generateInternal(Node* node, IssueList& issues) const {
+  if (!m_softMapBounds.has_value()) {
     return;
   }
-  if (!bounds.bounds->contains(node->logicalBounds())) {
+  if (!m_softMapBounds->contains(node->logicalBounds())) {
     issues.push_back(new SoftMapBoundsIssue(node));
   }
 }
@@ -25,6 +25,7 @@
 #include <vecmath/bbox.h>
 
 #include <memory>
+#include <optional>
 #include <vector>
 
 namespace TrenchBroom {
@@ -42,10 +43,17 @@ private:
   std::weak_ptr<Game> m_game;
   const WorldNode* m_world;
 
+  /**
+   * The bounds are parsed from the worldspawn property once before the nodes are validated, so that
+   * they can be read without locking while the nodes are validated in parallel.
+   */
+  std::optional<vm::bbox3> m_softMapBounds;
+
 public:
   explicit SoftMapBoundsIssueGenerator(std::weak_ptr<Game> game, const WorldNode* world);
 
 private:
+  void doPrepare() override;
   void generateInternal(Node* node, IssueList& issues) const;
   void doGenerate(EntityNode* brush, IssueList& issues) const override;
   void doGenerate(BrushNode* brush, IssueList& issues) const override;
@@ -21,6 +21,7 @@
 
 #include "AABBTree.h"
 #include "Ensure.h"
+#include "Exceptions.h"
 #include "Model/BrushFace.h"
 #include "Model/BrushNode.h"
 #include "Model/EntityNode.h"
@@ -52,7 +53,8 @@ WorldNode::WorldNode(
   , m_entityNodeIndex(std::make_unique<EntityNodeIndex>())
   , m_issueGeneratorRegistry(std::make_unique<IssueGeneratorRegistry>())
   , m_nodeTree(std::make_unique<NodeTree>())
-  , m_updateNodeTree(true) {
+  , m_updateNodeTree(true)
+  , m_nodeTreeBatchDepth(0) {
   entity.addOrUpdateProperty(
     m_entityPropertyConfig, EntityPropertyKeys::Classname,
     EntityPropertyValues::WorldspawnClassname);
@@ -181,6 +183,7 @@ void WorldNode::unregisterAllIssueGenerators() {
 
 void WorldNode::disableNodeTreeUpdates() {
   m_updateNodeTree = false;
+  m_pendingNodeTreeUpdates.clear();
 }
 
 void WorldNode::enableNodeTreeUpdates() {
@@ -219,11 +222,58 @@ void WorldNode::rebuildNodeTree() {
       addNode(patch);
     }));
 
+  m_pendingNodeTreeUpdates.clear();
   m_nodeTree->clearAndBuild(nodes, [](const auto* node) {
     return node->physicalBounds();
   });
 }
 
+void WorldNode::beginNodeTreeBatch() {
+  ++m_nodeTreeBatchDepth;
+}
+
+void WorldNode::endNodeTreeBatch() {
+  assert(m_nodeTreeBatchDepth > 0);
+  if (--m_nodeTreeBatchDepth == 0) {
+    updatePendingNodeTreeNodes();
+  }
+}
+
+WorldNode::NodeTreeBatch::NodeTreeBatch(WorldNode& worldNode)
+  : m_worldNode{worldNode}
+  , m_active{true} {
+  m_worldNode.beginNodeTreeBatch();
+}
+
+WorldNode::NodeTreeBatch::~NodeTreeBatch() {
+  if (m_active) {
+    // destructors must not throw, so repair the node tree instead of reporting the error
+    try {
+      end();
+    } catch (const NodeTreeException&) {
+      assert(false);
+      m_worldNode.rebuildNodeTree();
+    }
+  }
+}
+
+void WorldNode::NodeTreeBatch::end() {
+  assert(m_active);
+  m_active = false;
+  m_worldNode.endNodeTreeBatch();
+}
+
+void WorldNode::updatePendingNodeTreeNodes() {
+  if (!m_pendingNodeTreeUpdates.empty()) {
+    const auto nodes = kdl::vec_sort_and_remove_duplicates(std::move(m_pendingNodeTreeUpdates));
+    m_pendingNodeTreeUpdates.clear();
+
+    m_nodeTree->updateAll(nodes, [](const auto* node) {
+      return node->physicalBounds();
+    });
+  }
+}
+
 void WorldNode::invalidateAllIssues() {
   accept([](auto&& thisLambda, Node* node) {
     node->invalidateIssues();
@@ -379,6 +429,10 @@ void WorldNode::doDescendantWasAdded(Node* node, const size_t /* depth */) {
 void WorldNode::doDescendantWillBeRemoved(Node* node, const size_t /* depth */) {
   if (m_updateNodeTree) {
     const auto doRemove = [&](auto* nodeToRemove) {
+      if (!m_pendingNodeTreeUpdates.empty()) {
+        m_pendingNodeTreeUpdates =
+          kdl::vec_erase(std::move(m_pendingNodeTreeUpdates), nodeToRemove);
+      }
       if (!m_nodeTree->remove(nodeToRemove)) {
         auto str = std::stringstream();
         str << "Node not found with bounds " << nodeToRemove->physicalBounds() << ": "
@@ -412,16 +466,24 @@ void WorldNode::doDescendantWillBeRemoved(Node* node, const size_t /* depth */)
 
 void WorldNode::doDescendantPhysicalBoundsDidChange(Node* node) {
   if (m_updateNodeTree) {
+    const auto doUpdate = [&](auto* nodeToUpdate) {
+      if (m_nodeTreeBatchDepth > 0) {
+        m_pendingNodeTreeUpdates.push_back(nodeToUpdate);
+      } else {
+        m_nodeTree->update(nodeToUpdate->physicalBounds(), nodeToUpdate);
+      }
+    };
+
     node->accept(kdl::overload(
       [](WorldNode*) {}, [](LayerNode*) {}, [](GroupNode*) {},
       [&](EntityNode* entity) {
-        m_nodeTree->update(entity->physicalBounds(), entity);
+        doUpdate(entity);
       },
       [&](BrushNode* brush) {
-        m_nodeTree->update(brush->physicalBounds(), brush);
+        doUpdate(brush);
       },
       [&](PatchNode* patch) {
-        m_nodeTree->update(patch->physicalBounds(), patch);
+        doUpdate(patch);
       }));
   }
 }
@@ -432,12 +494,14 @@ bool WorldNode::doSelectable() const {
 
 void WorldNode::doPick(
   const EditorContext& editorContext, const vm::ray3& ray, PickResult& pickResult) {
+  updatePendingNodeTreeNodes();
   for (auto* node : m_nodeTree->findIntersectors(ray)) {
     node->pick(editorContext, ray, pickResult);
   }
 }
 
 void WorldNode::doFindNodesContaining(const vm::vec3& point, std::vector<Node*>& result) {
+  updatePendingNodeTreeNodes();
   for (auto* node : m_nodeTree->findContainers(point)) {
     node->findNodesContaining(point, result);
   }
@@ -56,6 +56,8 @@ private:
   using NodeTree = AABBTree<FloatType, 3, Node*>;
   std::unique_ptr<NodeTree> m_nodeTree;
   bool m_updateNodeTree;
+  size_t m_nodeTreeBatchDepth;
+  std::vector<Node*> m_pendingNodeTreeUpdates;
 
   IdType m_nextPersistentId = 1;
 
@@ -68,6 +70,11 @@ public:
 
   MapFormat mapFormat() const;
 
+  /**
+   * Returns the node tree. Changes made during a node tree batch are only applied to the node tree
+   * when the batch ends, so this function does not modify the node tree and can safely be called
+   * concurrently.
+   */
   const NodeTree& nodeTree() const;
 
 public: // layer management
@@ -135,7 +142,39 @@ public: // node tree bulk updating
   void enableNodeTreeUpdates();
   void rebuildNodeTree();
 
+  /**
+   * Defers the node tree updates caused by changes of the physical bounds of nodes until the
+   * matching call to endNodeTreeBatch(), which updates the node tree for all changed nodes at once.
+   * Batches can be nested, and the node tree is updated when the outermost batch ends. Pending
+   * updates are also applied before picking and before finding the nodes containing a point.
+   *
+   * Prefer NodeTreeBatch over calling these functions directly.
+   */
+  void beginNodeTreeBatch();
+  void endNodeTreeBatch();
+
+  /**
+   * Begins a node tree batch on construction. The batch should be ended by calling end(), which
+   * throws a NodeTreeException if the node tree cannot be updated. If the batch has not been ended
+   * when the guard is destroyed, e.g. because an exception was thrown while it was active, the
+   * destructor ends it and rebuilds the node tree if updating it fails.
+   */
+  class NodeTreeBatch {
+  private:
+    WorldNode& m_worldNode;
+    bool m_active;
+
+  public:
+    explicit NodeTreeBatch(WorldNode& worldNode);
+    ~NodeTreeBatch();
+
+    void end();
+
+    deleteCopyAndMove(NodeTreeBatch);
+  };
+
 private:
+  void updatePendingNodeTreeNodes();
   void invalidateAllIssues();
 
 private: // implement Node interface
@@ -0,0 +1,50 @@
+/*
+ Copyright (C) 2021 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <kdl/parallel.h>
+#include <kdl/vector_utils.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace TrenchBroom {
+/**
+ * Below this number of elements, nodes, faces and brushes are processed on the calling thread,
+ * since starting the worker threads costs more than the work itself.
+ */
+constexpr size_t MinParallelTransformSize = 64u;
+
+/**
+ * Applies the given lambda to each of the given elements and returns the results in the order of
+ * the given elements. The elements are processed in parallel only if there are many of them, so
+ * that small edits such as renaming a group or changing a face attribute do not pay for starting
+ * the worker threads.
+ *
+ * If the lambda throws an exception, the exception is propagated to the caller.
+ */
+template <typename T, typename L>
+auto transformMaybeInParallel(const std::vector<T>& elements, L&& transform) {
+  if (elements.size() < MinParallelTransformSize) {
+    return kdl::vec_transform(elements, transform);
+  }
+  return kdl::vec_parallel_transform(elements, transform);
+}
+} // namespace TrenchBroom
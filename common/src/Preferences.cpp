@@ -184,6 +184,8 @@ Preference<bool> EnableMSAA(IO::Path("Renderer/Enable multisampling"), true);
 
 Preference<bool> TextureLock(IO::Path("Editor/Texture lock"), true);
 Preference<bool> UVLock(IO::Path("Editor/UV lock"), false);
+Preference<bool> CSGMergeFragments(IO::Path("Editor/CSG merge fragments"), false);
+Preference<int> UndoMemoryBudget(IO::Path("Editor/Undo memory budget"), 0);
 
 Preference<IO::Path>& RendererFontPath() {
   static Preference<IO::Path> fontPath(
@@ -366,6 +368,8 @@ const std::vector<PreferenceBase*>& staticPreferences() {
     &TextureMagFilter,
     &TextureLock,
     &UVLock,
+    &CSGMergeFragments,
+    &UndoMemoryBudget,
     &RendererFontPath(),
     &RendererFontSize,
     &BrowserFontSize,
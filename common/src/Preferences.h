@@ -129,6 +129,12 @@ extern Preference<bool> EnableMSAA;
 extern Preference<bool> TextureLock;
 extern Preference<bool> UVLock;
 
+// whether CSG subtraction merges adjacent fragments whose union is convex
+extern Preference<bool> CSGMergeFragments;
+
+// in MiB, the oldest undo steps are dropped when it is exceeded; 0 (the default) disables the limit
+extern Preference<int> UndoMemoryBudget;
+
 Preference<IO::Path>& RendererFontPath();
 extern Preference<int> RendererFontSize;
 
@@ -28,6 +28,7 @@
 #include "Model/EditorContext.h"
 #include "Model/Entity.h"
 #include "Model/EntityNode.h"
+#include "Model/ModelUtils.h"
 #include "PreferenceManager.h"
 #include "Preferences.h"
 #include "Renderer/ActiveShader.h"
@@ -52,7 +53,8 @@ EntityModelRenderer::EntityModelRenderer(
   , m_entityModelManager{entityModelManager}
   , m_editorContext{editorContext}
   , m_applyTinting{false}
-  , m_showHiddenEntities{false} {}
+  , m_showHiddenEntities{false}
+  , m_transformation{vm::mat4x4::identity()} {}
 
 EntityModelRenderer::~EntityModelRenderer() {
   clear();
@@ -126,6 +128,10 @@ void EntityModelRenderer::setShowHiddenEntities(const bool showHiddenEntities) {
   m_showHiddenEntities = showHiddenEntities;
 }
 
+void EntityModelRenderer::setTransformation(const vm::mat4x4& transformation) {
+  m_transformation = transformation;
+}
+
 void EntityModelRenderer::render(RenderBatch& renderBatch) {
   renderBatch.add(this);
 }
@@ -173,7 +179,16 @@ void EntityModelRenderer::doRender(RenderContext& renderContext) {
 
     shader.set("Orientation", static_cast<int>(model->orientation()));
 
-    const auto transformation = vm::mat4x4f{entityNode->entity().modelTransformation()};
+    auto modelTransformation = entityNode->entity().modelTransformation();
+    if (
+      m_transformation != vm::mat4x4::identity() &&
+      Model::isTransformedWithSelection(*entityNode)) {
+      auto entity = entityNode->entity();
+      entity.transform(entityNode->entityPropertyConfig(), m_transformation);
+      modelTransformation = entity.modelTransformation();
+    }
+
+    const auto transformation = vm::mat4x4f{modelTransformation};
     const auto multMatrix = MultiplyModelMatrix{renderContext.transformation(), transformation};
 
     shader.set("ModelMatrix", transformation);
@@ -20,8 +20,11 @@
 #pragma once
 
 #include "Color.h"
+#include "FloatType.h"
 #include "Renderer/Renderable.h"
 
+#include <vecmath/mat.h>
+
 #include <unordered_map>
 
 namespace TrenchBroom {
@@ -55,6 +58,8 @@ private:
 
   bool m_showHiddenEntities;
 
+  vm::mat4x4 m_transformation;
+
 public:
   EntityModelRenderer(
     Logger& logger, Assets::EntityModelManager& entityModelManager,
@@ -93,6 +98,12 @@ public:
   bool showHiddenEntities() const;
   void setShowHiddenEntities(bool showHiddenEntities);
 
+  /**
+   * Renders the models of the entities that are transformed with the selection as if the given
+   * transformation had been applied to them.
+   */
+  void setTransformation(const vm::mat4x4& transformation);
+
   void render(RenderBatch& renderBatch);
 
 private:
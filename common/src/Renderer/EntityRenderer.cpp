@@ -26,6 +26,7 @@
 #include "Model/EditorContext.h"
 #include "Model/Entity.h"
 #include "Model/EntityNode.h"
+#include "Model/ModelUtils.h"
 #include "PreferenceManager.h"
 #include "Preferences.h"
 #include "Renderer/Camera.h"
@@ -48,16 +49,16 @@ namespace TrenchBroom {
 namespace Renderer {
 class EntityRenderer::EntityClassnameAnchor : public TextAnchor3D {
 private:
-  const Model::EntityNode* m_entity;
+  vm::bbox3 m_bounds;
 
 public:
-  EntityClassnameAnchor(const Model::EntityNode* entity)
-    : m_entity(entity) {}
+  EntityClassnameAnchor(const vm::bbox3& bounds)
+    : m_bounds(bounds) {}
 
 private:
   vm::vec3f basePosition() const override {
-    auto position = vm::vec3f(m_entity->logicalBounds().center());
-    position[2] = float(m_entity->logicalBounds().max.z());
+    auto position = vm::vec3f(m_bounds.center());
+    position[2] = float(m_bounds.max.z());
     position[2] += 2.0f;
     return position;
   }
@@ -72,6 +73,7 @@ EntityRenderer::EntityRenderer(
   , m_editorContext(editorContext)
   , m_modelRenderer(logger, m_entityModelManager, m_editorContext)
   , m_boundsValid(false)
+  , m_transformation(vm::mat4x4::identity())
   , m_showOverlays(true)
   , m_showOccludedOverlays(false)
   , m_tint(false)
@@ -169,6 +171,14 @@ void EntityRenderer::setShowHiddenEntities(const bool showHiddenEntities) {
   m_showHiddenEntities = showHiddenEntities;
 }
 
+void EntityRenderer::setTransformation(const vm::mat4x4& transformation) {
+  if (transformation != m_transformation) {
+    m_transformation = transformation;
+    m_modelRenderer.setTransformation(transformation);
+    invalidateBounds();
+  }
+}
+
 void EntityRenderer::render(RenderContext& renderContext, RenderBatch& renderBatch) {
   if (!m_entities.empty()) {
     renderBounds(renderContext, renderBatch);
@@ -241,7 +251,8 @@ void EntityRenderer::renderClassnames(RenderContext& renderContext, RenderBatch&
             renderService.setShowOccludedObjects();
           else
             renderService.setHideOccludedObjects();
-          renderService.renderString(entityString(entity), EntityClassnameAnchor(entity));
+          renderService.renderString(
+            entityString(entity), EntityClassnameAnchor(entityBounds(entity)));
         }
       }
     }
@@ -266,9 +277,11 @@ void EntityRenderer::renderAngles(RenderContext& renderContext, RenderBatch& ren
       continue;
     }
 
-    const auto rotation = vm::mat4x4f(entityNode->entity().rotation());
+    const auto rotation = vm::mat4x4f(
+      isTransformed(entityNode) ? transformedEntity(entityNode).rotation()
+                                : entityNode->entity().rotation());
     const auto direction = rotation * vm::vec3f::pos_x();
-    const auto center = vm::vec3f(entityNode->logicalBounds().center());
+    const auto center = vm::vec3f(entityBounds(entityNode).center());
 
     const auto toCam = renderContext.camera().position() - center;
     // only distance cull for perspective camera, since the 2D one is always very far from the level
@@ -376,15 +389,15 @@ void EntityRenderer::validateBounds() {
       if (m_editorContext.visible(entityNode)) {
         const bool pointEntity = !entityNode->hasChildren();
         if (pointEntity) {
-          entityNode->logicalBounds().for_each_edge(pointEntityWireframeBoundsBuilder);
+          entityBounds(entityNode).for_each_edge(pointEntityWireframeBoundsBuilder);
         } else {
-          entityNode->logicalBounds().for_each_edge(brushEntityWireframeBoundsBuilder);
+          entityBounds(entityNode).for_each_edge(brushEntityWireframeBoundsBuilder);
         }
 
         if (pointEntity && entityNode->entity().model() == nullptr) {
           BuildColoredSolidBoundsVertices solidBoundsBuilder(
             solidVertices, boundsColor(entityNode));
-          entityNode->logicalBounds().for_each_face(solidBoundsBuilder);
+          entityBounds(entityNode).for_each_face(solidBoundsBuilder);
         }
       }
     }
@@ -408,7 +421,7 @@ void EntityRenderer::validateBounds() {
         if (pointEntity && entityNode->entity().model() == nullptr) {
           BuildColoredSolidBoundsVertices solidBoundsBuilder(
             solidVertices, boundsColor(entityNode));
-          entityNode->logicalBounds().for_each_face(solidBoundsBuilder);
+          entityBounds(entityNode).for_each_face(solidBoundsBuilder);
         } else {
           BuildColoredWireframeBoundsVertices pointEntityWireframeBoundsBuilder(
             pointEntityWireframeVertices, boundsColor(entityNode));
@@ -416,9 +429,9 @@ void EntityRenderer::validateBounds() {
             brushEntityWireframeVertices, boundsColor(entityNode));
 
           if (pointEntity) {
-            entityNode->logicalBounds().for_each_edge(pointEntityWireframeBoundsBuilder);
+            entityBounds(entityNode).for_each_edge(pointEntityWireframeBoundsBuilder);
           } else {
-            entityNode->logicalBounds().for_each_edge(brushEntityWireframeBoundsBuilder);
+            entityBounds(entityNode).for_each_edge(brushEntityWireframeBoundsBuilder);
           }
         }
       }
@@ -435,6 +448,29 @@ void EntityRenderer::validateBounds() {
   m_boundsValid = true;
 }
 
+bool EntityRenderer::isTransformed(const Model::EntityNode* entityNode) const {
+  return m_transformation != vm::mat4x4::identity() &&
+         Model::isTransformedWithSelection(*entityNode);
+}
+
+Model::Entity EntityRenderer::transformedEntity(const Model::EntityNode* entityNode) const {
+  auto entity = entityNode->entity();
+  entity.transform(entityNode->entityPropertyConfig(), m_transformation);
+  return entity;
+}
+
+vm::bbox3 EntityRenderer::entityBounds(const Model::EntityNode* entityNode) const {
+  if (!isTransformed(entityNode)) {
+    return entityNode->logicalBounds();
+  }
+  if (entityNode->hasChildren()) {
+    // the bounds of a brush entity follow its brushes, which are transformed as a whole
+    return entityNode->logicalBounds().transform(m_transformation);
+  }
+  const auto offset = transformedEntity(entityNode).origin() - entityNode->entity().origin();
+  return entityNode->logicalBounds().translate(offset);
+}
+
 AttrString EntityRenderer::entityString(const Model::EntityNode* entityNode) const {
   const auto& classname = entityNode->entity().classname();
   // const Model::AttributeValue& targetname = entity->attribute(Model::AttributeNames::Targetname);
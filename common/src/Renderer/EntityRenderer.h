@@ -20,13 +20,17 @@
 #pragma once
 
 #include "Color.h"
+#include "FloatType.h"
 #include "Renderer/EdgeRenderer.h"
 #include "Renderer/EntityModelRenderer.h"
 #include "Renderer/Renderable.h"
 #include "Renderer/TriangleRenderer.h"
 
 #include <kdl/vector_set.h>
+
+#include <vecmath/bbox.h>
 #include <vecmath/forward.h>
+#include <vecmath/mat.h>
 
 #include <vector>
 
@@ -39,6 +43,7 @@ class EntityModelManager;
 
 namespace Model {
 class EditorContext;
+class Entity;
 class EntityNode;
 } // namespace Model
 
@@ -59,6 +64,7 @@ private:
   TriangleRenderer m_solidBoundsRenderer;
   EntityModelRenderer m_modelRenderer;
   bool m_boundsValid;
+  vm::mat4x4 m_transformation;
 
   bool m_showOverlays;
   Color m_overlayTextColor;
@@ -122,6 +128,13 @@ public:
 
   void setShowHiddenEntities(bool showHiddenEntities);
 
+  /**
+   * Transforms the entities that are transformed with the selection like Entity::transform does,
+   * i.e. point entities are moved and their models and angles are rotated, but their bounds are
+   * not rotated or scaled.
+   */
+  void setTransformation(const vm::mat4x4& transformation);
+
 public: // rendering
   void render(RenderContext& renderContext, RenderBatch& renderBatch);
 
@@ -142,6 +155,10 @@ private:
   void invalidateBounds();
   void validateBounds();
 
+  bool isTransformed(const Model::EntityNode* entityNode) const;
+  Model::Entity transformedEntity(const Model::EntityNode* entityNode) const;
+  vm::bbox3 entityBounds(const Model::EntityNode* entityNode) const;
+
   AttrString entityString(const Model::EntityNode* entityNode) const;
   const Color& boundsColor(const Model::EntityNode* entityNode) const;
 };
@@ -54,19 +54,21 @@ FreeTypeFontFactory::~FreeTypeFontFactory() {
 
 std::unique_ptr<TextureFont> FreeTypeFontFactory::doCreateFont(
   const FontDescriptor& fontDescriptor) {
-  auto [face, bufferedReader] = loadFont(fontDescriptor);
+  auto [face, file, bufferedReader] = loadFont(fontDescriptor);
   auto font = buildFont(face, fontDescriptor.minChar(), fontDescriptor.charCount());
   FT_Done_Face(face);
 
-  // NOTE: bufferedReader is returned from loadFont() just to keep the buffer from
-  // being deallocated until after we call FT_Done_Face
+  // NOTE: file and bufferedReader are returned from loadFont() just to keep the buffer from
+  // being deallocated until after we call FT_Done_Face. Depending on the file type, the buffer is
+  // owned either by the reader or by the file.
+  unused(file);
   unused(bufferedReader);
 
   return font;
 }
 
-std::pair<FT_Face, IO::BufferedReader> FreeTypeFontFactory::loadFont(
-  const FontDescriptor& fontDescriptor) {
+std::tuple<FT_Face, std::shared_ptr<IO::File>, IO::BufferedReader> FreeTypeFontFactory::
+  loadFont(const FontDescriptor& fontDescriptor) {
   const auto fontPath = fontDescriptor.path().isAbsolute()
                           ? fontDescriptor.path()
                           : IO::SystemPaths::findResourceFile(fontDescriptor.path());
@@ -86,7 +88,7 @@ std::pair<FT_Face, IO::BufferedReader> FreeTypeFontFactory::loadFont(
   const auto fontSize = static_cast<FT_UInt>(fontDescriptor.size());
   FT_Set_Pixel_Sizes(face, 0, fontSize);
 
-  return {face, std::move(reader)};
+  return {face, std::move(file), std::move(reader)};
 }
 
 std::unique_ptr<TextureFont> FreeTypeFontFactory::buildFont(
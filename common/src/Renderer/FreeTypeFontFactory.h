@@ -26,9 +26,13 @@
 #include "Renderer/FontFactory.h"
 
 #include <memory>
-#include <utility>
+#include <tuple>
 
 namespace TrenchBroom {
+namespace IO {
+class File;
+}
+
 namespace Renderer {
 class FontDescriptor;
 class TextureFont;
@@ -44,7 +48,8 @@ public:
 private:
   std::unique_ptr<TextureFont> doCreateFont(const FontDescriptor& fontDescriptor) override;
 
-  std::pair<FT_Face, IO::BufferedReader> loadFont(const FontDescriptor& fontDescriptor);
+  std::tuple<FT_Face, std::shared_ptr<IO::File>, IO::BufferedReader> loadFont(
+    const FontDescriptor& fontDescriptor);
   std::unique_ptr<TextureFont> buildFont(
     FT_Face face, unsigned char firstChar, unsigned char charCount);
 
@@ -21,6 +21,7 @@
 
 #include "Model/EditorContext.h"
 #include "Model/GroupNode.h"
+#include "Model/ModelUtils.h"
 #include "PreferenceManager.h"
 #include "Preferences.h"
 #include "Renderer/GLVertexType.h"
@@ -36,16 +37,16 @@ namespace TrenchBroom {
 namespace Renderer {
 class GroupRenderer::GroupNameAnchor : public TextAnchor3D {
 private:
-  const Model::GroupNode* m_group;
+  vm::bbox3 m_bounds;
 
 public:
-  GroupNameAnchor(const Model::GroupNode* group)
-    : m_group(group) {}
+  GroupNameAnchor(const vm::bbox3& bounds)
+    : m_bounds(bounds) {}
 
 private:
   vm::vec3f basePosition() const override {
-    auto position = vm::vec3f(m_group->logicalBounds().center());
-    position[2] = float(m_group->logicalBounds().max.z());
+    auto position = vm::vec3f(m_bounds.center());
+    position[2] = float(m_bounds.max.z());
     position[2] += 2.0f;
     return position;
   }
@@ -56,6 +57,7 @@ private:
 GroupRenderer::GroupRenderer(const Model::EditorContext& editorContext)
   : m_editorContext(editorContext)
   , m_boundsValid(false)
+  , m_transformation(vm::mat4x4::identity())
   , m_overrideColors(false)
   , m_showOverlays(true)
   , m_showOccludedOverlays(false)
@@ -119,6 +121,13 @@ void GroupRenderer::setOccludedBoundsColor(const Color& occludedBoundsColor) {
   m_occludedBoundsColor = occludedBoundsColor;
 }
 
+void GroupRenderer::setTransformation(const vm::mat4x4& transformation) {
+  if (transformation != m_transformation) {
+    m_transformation = transformation;
+    invalidateBounds();
+  }
+}
+
 void GroupRenderer::render(RenderContext& renderContext, RenderBatch& renderBatch) {
   if (!m_groups.empty()) {
     if (renderContext.showGroupBounds()) {
@@ -155,7 +164,7 @@ void GroupRenderer::renderNames(RenderContext& renderContext, RenderBatch& rende
           renderService.setForegroundColor(groupColor(group));
         }
 
-        const GroupNameAnchor anchor(group);
+        const GroupNameAnchor anchor(groupBounds(group));
         if (m_showOccludedOverlays) {
           renderService.setShowOccludedObjects();
         } else {
@@ -178,7 +187,7 @@ void GroupRenderer::validateBounds() {
 
     for (const Model::GroupNode* group : m_groups) {
       if (shouldRenderGroup(group)) {
-        group->logicalBounds().for_each_edge([&](const vm::vec3& v1, const vm::vec3& v2) {
+        groupBounds(group).for_each_edge([&](const vm::vec3& v1, const vm::vec3& v2) {
           vertices.emplace_back(vm::vec3f(v1));
           vertices.emplace_back(vm::vec3f(v2));
         });
@@ -193,7 +202,7 @@ void GroupRenderer::validateBounds() {
     for (const Model::GroupNode* group : m_groups) {
       if (shouldRenderGroup(group)) {
         const auto color = groupColor(group);
-        group->logicalBounds().for_each_edge([&](const vm::vec3& v1, const vm::vec3& v2) {
+        groupBounds(group).for_each_edge([&](const vm::vec3& v1, const vm::vec3& v2) {
           vertices.emplace_back(vm::vec3f(v1), color);
           vertices.emplace_back(vm::vec3f(v2), color);
         });
@@ -212,6 +221,13 @@ bool GroupRenderer::shouldRenderGroup(const Model::GroupNode* group) const {
   return parentGroup == currentGroup && m_editorContext.visible(group);
 }
 
+vm::bbox3 GroupRenderer::groupBounds(const Model::GroupNode* group) const {
+  if (m_transformation != vm::mat4x4::identity() && Model::isTransformedWithSelection(*group)) {
+    return group->logicalBounds().transform(m_transformation);
+  }
+  return group->logicalBounds();
+}
+
 AttrString GroupRenderer::groupString(const Model::GroupNode* groupNode) const {
   if (groupNode->group().linkedGroupId()) {
     return groupNode->name() + " (linked)";
@@ -21,10 +21,14 @@
 
 #include "AttrString.h"
 #include "Color.h"
+#include "FloatType.h"
 #include "Renderer/EdgeRenderer.h"
 
 #include <kdl/vector_set.h>
 
+#include <vecmath/bbox.h>
+#include <vecmath/mat.h>
+
 #include <vector>
 
 namespace TrenchBroom {
@@ -46,6 +50,7 @@ private:
 
   DirectEdgeRenderer m_boundsRenderer;
   bool m_boundsValid;
+  vm::mat4x4 m_transformation;
 
   bool m_overrideColors;
   bool m_showOverlays;
@@ -94,6 +99,13 @@ public:
   void setShowOccludedBounds(bool showOccludedBounds);
   void setOccludedBoundsColor(const Color& occludedBoundsColor);
 
+  /**
+   * Transforms the bounds of the groups that are transformed with the selection. The bounds are
+   * transformed as boxes, so a rotation may preview them slightly larger than the bounds of the
+   * rotated group contents.
+   */
+  void setTransformation(const vm::mat4x4& transformation);
+
 public: // rendering
   void render(RenderContext& renderContext, RenderBatch& renderBatch);
 
@@ -105,6 +117,7 @@ private:
   void validateBounds();
 
   bool shouldRenderGroup(const Model::GroupNode* group) const;
+  vm::bbox3 groupBounds(const Model::GroupNode* group) const;
 
   AttrString groupString(const Model::GroupNode* group) const;
   Color groupColor(const Model::GroupNode* group) const;
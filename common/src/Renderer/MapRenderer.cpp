@@ -238,6 +238,7 @@ void MapRenderer::renderDefaultTransparent(RenderContext& renderContext, RenderB
 
 void MapRenderer::renderSelectionOpaque(RenderContext& renderContext, RenderBatch& renderBatch) {
   if (!renderContext.hideSelection()) {
+    m_selectionRenderer->setTransformation(renderContext.selectionTransformation());
     m_selectionRenderer->renderOpaque(renderContext, renderBatch);
   }
 }
@@ -245,6 +246,7 @@ void MapRenderer::renderSelectionOpaque(RenderContext& renderContext, RenderBatc
 void MapRenderer::renderSelectionTransparent(
   RenderContext& renderContext, RenderBatch& renderBatch) {
   if (!renderContext.hideSelection()) {
+    m_selectionRenderer->setTransformation(renderContext.selectionTransformation());
     m_selectionRenderer->renderTransparent(renderContext, renderBatch);
   }
 }
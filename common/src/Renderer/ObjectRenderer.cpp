@@ -20,11 +20,38 @@
 #include "ObjectRenderer.h"
 
 #include "Model/GroupNode.h"
+#include "Renderer/RenderBatch.h"
+#include "Renderer/RenderContext.h"
+#include "Renderer/Renderable.h"
+#include "Renderer/Transformation.h"
 
 #include <kdl/overload.h>
 
 namespace TrenchBroom {
 namespace Renderer {
+namespace {
+class PushModelMatrix : public Renderable {
+private:
+  vm::mat4x4f m_matrix;
+
+public:
+  explicit PushModelMatrix(const vm::mat4x4f& matrix)
+    : m_matrix{matrix} {}
+
+private:
+  void doRender(RenderContext& renderContext) override {
+    renderContext.transformation().pushModelMatrix(m_matrix);
+  }
+};
+
+class PopModelMatrix : public Renderable {
+private:
+  void doRender(RenderContext& renderContext) override {
+    renderContext.transformation().popModelMatrix();
+  }
+};
+} // namespace
+
 void ObjectRenderer::addNode(Model::Node* node) {
   node->accept(kdl::overload(
     [](Model::WorldNode*) {}, [](Model::LayerNode*) {},
@@ -189,15 +216,38 @@ void ObjectRenderer::setShowHiddenObjects(const bool showHiddenObjects) {
   m_brushRenderer.setShowHiddenBrushes(showHiddenObjects);
 }
 
+void ObjectRenderer::setTransformation(const vm::mat4x4& transformation) {
+  m_transformation = transformation;
+  m_entityRenderer.setTransformation(transformation);
+  m_groupRenderer.setTransformation(transformation);
+}
+
 void ObjectRenderer::renderOpaque(RenderContext& renderContext, RenderBatch& renderBatch) {
+  pushTransformation(renderBatch);
   m_brushRenderer.renderOpaque(renderContext, renderBatch);
   m_patchRenderer.render(renderContext, renderBatch);
+  popTransformation(renderBatch);
+
   m_entityRenderer.render(renderContext, renderBatch);
   m_groupRenderer.render(renderContext, renderBatch);
 }
 
 void ObjectRenderer::renderTransparent(RenderContext& renderContext, RenderBatch& renderBatch) {
+  pushTransformation(renderBatch);
   m_brushRenderer.renderTransparent(renderContext, renderBatch);
+  popTransformation(renderBatch);
+}
+
+void ObjectRenderer::pushTransformation(RenderBatch& renderBatch) {
+  if (m_transformation != vm::mat4x4::identity()) {
+    renderBatch.addOneShot(new PushModelMatrix{vm::mat4x4f{m_transformation}});
+  }
+}
+
+void ObjectRenderer::popTransformation(RenderBatch& renderBatch) {
+  if (m_transformation != vm::mat4x4::identity()) {
+    renderBatch.addOneShot(new PopModelMatrix{});
+  }
 }
 } // namespace Renderer
 } // namespace TrenchBroom
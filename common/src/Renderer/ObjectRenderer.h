@@ -19,11 +19,14 @@
 
 #pragma once
 
+#include "FloatType.h"
 #include "Renderer/BrushRenderer.h"
 #include "Renderer/EntityRenderer.h"
 #include "Renderer/GroupRenderer.h"
 #include "Renderer/PatchRenderer.h"
 
+#include <vecmath/mat.h>
+
 #include <vector>
 
 namespace TrenchBroom {
@@ -53,6 +56,7 @@ private:
   EntityRenderer m_entityRenderer;
   BrushRenderer m_brushRenderer;
   PatchRenderer m_patchRenderer;
+  vm::mat4x4 m_transformation;
 
 public:
   template <typename BrushFilterT>
@@ -62,7 +66,8 @@ public:
     : m_groupRenderer(editorContext)
     , m_entityRenderer(logger, entityModelManager, editorContext)
     , m_brushRenderer(brushFilter)
-    , m_patchRenderer{} {}
+    , m_patchRenderer{}
+    , m_transformation{vm::mat4x4::identity()} {}
 
 public: // object management
   void addNode(Model::Node* node);
@@ -101,11 +106,22 @@ public: // configuration
 
   void setShowHiddenObjects(bool showHiddenObjects);
 
+  /**
+   * Renders the objects that are transformed with the selection as if the given transformation had
+   * been applied to them. Brushes and patches are rendered with the transformation as their model
+   * matrix, so their vertices need not be updated. Containers whose contents are only partially
+   * selected are not transformed.
+   */
+  void setTransformation(const vm::mat4x4& transformation);
+
 public: // rendering
   void renderOpaque(RenderContext& renderContext, RenderBatch& renderBatch);
   void renderTransparent(RenderContext& renderContext, RenderBatch& renderBatch);
 
 private:
+  void pushTransformation(RenderBatch& renderBatch);
+  void popTransformation(RenderBatch& renderBatch);
+
   ObjectRenderer(const ObjectRenderer&);
   ObjectRenderer& operator=(const ObjectRenderer&);
 };
@@ -45,6 +45,7 @@ RenderContext::RenderContext(
   , m_gridSize(4)
   , m_hideSelection(false)
   , m_tintSelection(true)
+  , m_selectionTransformation(vm::mat4x4::identity())
   , m_showSelectionGuide(ShowSelectionGuide::Hide) {}
 
 bool RenderContext::render2D() const {
@@ -199,6 +200,14 @@ void RenderContext::clearTintSelection() {
   m_tintSelection = false;
 }
 
+const vm::mat4x4& RenderContext::selectionTransformation() const {
+  return m_selectionTransformation;
+}
+
+void RenderContext::setSelectionTransformation(const vm::mat4x4& selectionTransformation) {
+  m_selectionTransformation = selectionTransformation;
+}
+
 bool RenderContext::showSelectionGuide() const {
   return m_showSelectionGuide == ShowSelectionGuide::Show ||
          m_showSelectionGuide == ShowSelectionGuide::ForceShow;
@@ -23,6 +23,7 @@
 #include "Renderer/Transformation.h"
 
 #include <vecmath/bbox.h>
+#include <vecmath/mat.h>
 
 namespace TrenchBroom {
 namespace Renderer {
@@ -72,6 +73,7 @@ private:
 
   bool m_hideSelection;
   bool m_tintSelection;
+  vm::mat4x4 m_selectionTransformation;
 
   ShowSelectionGuide m_showSelectionGuide;
   vm::bbox3f m_sofMapBounds;
@@ -137,6 +139,17 @@ public:
   bool tintSelection() const;
   void clearTintSelection();
 
+  /**
+   * A transformation that is applied to the selected objects when they are rendered. Tools use
+   * this to preview a transformation during a drag without applying it to the document.
+   *
+   * The preview matches the transformation that is applied when the drag is committed, except that
+   * textures always follow the transformed brushes as if texture lock were enabled, since the
+   * texture coordinates are part of the brush vertices that are reused for the preview.
+   */
+  const vm::mat4x4& selectionTransformation() const;
+  void setSelectionTransformation(const vm::mat4x4& selectionTransformation);
+
   bool showSelectionGuide() const;
   void setShowSelectionGuide();
   void setHideSelectionGuide();
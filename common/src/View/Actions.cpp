@@ -1594,6 +1594,18 @@ void ActionManager::createEditMenu() { /* ========== Edit Menu ========== */
     [](ActionExecutionContext& context) {
       return context.hasDocument() && context.frame()->canDoCsgIntersect();
     }));
+  csgMenu.addSeparator();
+  csgMenu.addItem(createMenuAction(
+    IO::Path("Menu/Edit/CSG/Merge Fragments"), QObject::tr("Merge Fragments"), 0,
+    [](ActionExecutionContext& context) {
+      context.frame()->toggleCsgMergeFragments();
+    },
+    [](ActionExecutionContext& context) {
+      return context.hasDocument();
+    },
+    [](ActionExecutionContext&) {
+      return pref(Preferences::CSGMergeFragments);
+    }));
 
   editMenu.addSeparator();
   editMenu.addItem(createMenuAction(
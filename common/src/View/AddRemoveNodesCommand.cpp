@@ -21,11 +21,19 @@
 
 #include "Ensure.h"
 #include "Macros.h"
+#include "Model/BrushNode.h"
+#include "Model/EntityNode.h"
+#include "Model/GroupNode.h"
+#include "Model/LayerNode.h"
 #include "Model/Node.h"
+#include "Model/NodeContents.h"
+#include "Model/PatchNode.h"
+#include "Model/WorldNode.h"
 #include "Model/UpdateLinkedGroupsError.h"
 #include "View/MapDocumentCommandFacade.h"
 
 #include <kdl/map_utils.h>
+#include <kdl/overload.h>
 #include <kdl/result.h>
 
 #include <map>
@@ -145,5 +153,41 @@ void AddRemoveNodesCommand::undoAction(MapDocumentCommandFacade* document) {
 bool AddRemoveNodesCommand::doCollateWith(UndoableCommand*) {
   return false;
 }
+
+size_t AddRemoveNodesCommand::doGetMemoryUsage() const {
+  auto result = sizeof(*this) + name().capacity();
+
+  // only the nodes to add are owned by this command, the nodes to remove are owned by the document
+  for (const auto& [parent, children] : m_nodesToAdd) {
+    unused(parent);
+    Model::Node::visitAll(
+      children,
+      kdl::overload(
+        [&](auto&& thisLambda, const Model::WorldNode* worldNode) {
+          result += sizeof(Model::WorldNode) + Model::memoryUsage(worldNode->entity());
+          worldNode->visitChildren(thisLambda);
+        },
+        [&](auto&& thisLambda, const Model::LayerNode* layerNode) {
+          result += sizeof(Model::LayerNode);
+          layerNode->visitChildren(thisLambda);
+        },
+        [&](auto&& thisLambda, const Model::GroupNode* groupNode) {
+          result += sizeof(Model::GroupNode);
+          groupNode->visitChildren(thisLambda);
+        },
+        [&](auto&& thisLambda, const Model::EntityNode* entityNode) {
+          result += sizeof(Model::EntityNode) + Model::memoryUsage(entityNode->entity());
+          entityNode->visitChildren(thisLambda);
+        },
+        [&](const Model::BrushNode* brushNode) {
+          result += sizeof(Model::BrushNode) + Model::memoryUsage(brushNode->brush());
+        },
+        [&](const Model::PatchNode* patchNode) {
+          result += sizeof(Model::PatchNode) + Model::memoryUsage(patchNode->patch());
+        }));
+  }
+
+  return result;
+}
 } // namespace View
 } // namespace TrenchBroom
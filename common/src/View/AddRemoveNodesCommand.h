@@ -80,6 +80,8 @@ private:
 
   bool doCollateWith(UndoableCommand* command) override;
 
+  size_t doGetMemoryUsage() const override;
+
   deleteCopyAndMove(AddRemoveNodesCommand);
 };
 } // namespace View
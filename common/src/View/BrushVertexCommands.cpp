@@ -43,7 +43,7 @@ std::unique_ptr<CommandResult> BrushVertexCommandBase::createCommandResult(
 }
 
 static auto collectBrushNodes(
-  const std::vector<std::pair<Model::Node*, Model::NodeContents>> nodes) {
+  const std::vector<std::pair<Model::Node*, Model::NodeContentsDelta>>& nodes) {
   auto result = std::vector<Model::BrushNode*>{};
   for (const auto& [node, contents] : nodes) {
     if (auto* brushNode = dynamic_cast<Model::BrushNode*>(node)) {
@@ -30,6 +30,7 @@
 #include "Model/PickResult.h"
 #include "Model/Polyhedron.h"
 #include "Model/WorldNode.h"
+#include "ParallelUtils.h"
 #include "PreferenceManager.h"
 #include "Preferences.h"
 #include "Renderer/BrushRenderer.h"
@@ -41,10 +42,13 @@
 #include <kdl/map_utils.h>
 #include <kdl/memory_utils.h>
 #include <kdl/overload.h>
+#include <kdl/result.h>
+#include <kdl/result_for_each.h>
 #include <kdl/set_temp.h>
 #include <kdl/string_utils.h>
 #include <kdl/vector_utils.h>
 
+#include <vecmath/plane.h>
 #include <vecmath/ray.h>
 #include <vecmath/vec.h>
 #include <vecmath/vec_io.h>
@@ -739,7 +743,9 @@ void ClipTool::endDragPoint() {
   ensure(m_strategy != nullptr, "strategy is null");
   m_strategy->endDragPoint();
   m_dragging = false;
-  refreshViews();
+
+  // replace the preview with the exact result
+  update();
 }
 
 void ClipTool::cancelDragPoint() {
@@ -747,7 +753,7 @@ void ClipTool::cancelDragPoint() {
   ensure(m_strategy != nullptr, "strategy is null");
   m_strategy->cancelDragPoint();
   m_dragging = false;
-  refreshViews();
+  update();
 }
 
 void ClipTool::setFace(const Model::BrushFaceHandle& faceHandle) {
@@ -785,39 +791,127 @@ void ClipTool::clearBrushes() {
   kdl::map_clear_and_delete(m_backBrushes);
 }
 
+namespace {
+enum class BrushSide {
+  Below,
+  Above,
+  Both
+};
+
+/**
+ * Determines on which side of the given plane the vertices of the given brush lie. Vertices on the
+ * plane are ignored, so a brush that only touches the plane is on one side of it.
+ */
+BrushSide classifyBrush(const Model::Brush& brush, const vm::plane3& plane) {
+  auto above = false;
+  auto below = false;
+  for (const auto* vertex : brush.vertices()) {
+    switch (plane.point_status(vertex->position(), vm::C::point_status_epsilon())) {
+      case vm::plane_status::above:
+        above = true;
+        break;
+      case vm::plane_status::below:
+        below = true;
+        break;
+      case vm::plane_status::inside:
+        break;
+        switchDefault();
+    }
+
+    if (above && below) {
+      return BrushSide::Both;
+    }
+  }
+  return above ? BrushSide::Above : BrushSide::Below;
+}
+
+struct ClippedBrushes {
+  std::vector<kdl::result<Model::Brush, Model::BrushError>> frontBrushes;
+  std::vector<kdl::result<Model::Brush, Model::BrushError>> backBrushes;
+};
+} // namespace
+
 void ClipTool::updateBrushes() {
   auto document = kdl::mem_lock(m_document);
 
   const auto& brushNodes = document->selectedNodes().brushes();
   const auto& worldBounds = document->worldBounds();
 
-  const auto clip =
-    [&](auto* node, const auto& p1, const auto& p2, const auto& p3, auto& brushMap) {
-      auto brush = node->brush();
-      Model::BrushFace::create(
-        p1, p2, p3, Model::BrushFaceAttributes(document->currentTextureName()),
-        document->world()->mapFormat())
-        .and_then([&](Model::BrushFace&& clipFace) {
-          setFaceAttributes(brush.faces(), clipFace);
-          return brush.clip(worldBounds, std::move(clipFace));
-        })
-        .and_then([&]() {
-          brushMap[node->parent()].push_back(new Model::BrushNode(std::move(brush)));
-        })
-        .handle_errors([&](const Model::BrushError e) {
-          document->error() << "Could not clip brush: " << e;
-        });
-    };
-
   if (canClip()) {
     vm::vec3 point1, point2, point3;
     const auto numPoints = m_strategy->getPoints(point1, point2, point3);
     ensure(numPoints == 3, "invalid number of points");
 
-    for (auto* brushNode : brushNodes) {
-      clip(brushNode, point1, point2, point3, m_frontBrushes);
-      clip(brushNode, point1, point3, point2, m_backBrushes);
-    }
+    const auto attributes = Model::BrushFaceAttributes(document->currentTextureName());
+    const auto mapFormat = document->world()->mapFormat();
+
+    Model::BrushFace::create(point1, point2, point3, attributes, mapFormat)
+      .and_then([&](Model::BrushFace&& frontClipFace) {
+        return Model::BrushFace::create(point1, point3, point2, attributes, mapFormat)
+          .and_then([&](Model::BrushFace&& backClipFace) {
+            // While a clip point is dragged, brushes that are entirely on one side of the clip
+            // plane are kept as they are instead of being clipped. Brushes that are entirely on
+            // the other side cannot contribute any fragment, so they are always skipped.
+            const auto preview = m_dragging;
+            const auto& plane = frontClipFace.boundary();
+
+            const auto clip = [&](const Model::Brush& brush, Model::BrushFace clipFace) {
+              auto clippedBrush = brush;
+              setFaceAttributes(clippedBrush.faces(), clipFace);
+              return clippedBrush.clip(worldBounds, std::move(clipFace)).and_then([&]() {
+                return std::move(clippedBrush);
+              });
+            };
+
+            const auto clipOrKeep = [&](
+                                      const Model::Brush& brush, const Model::BrushFace& clipFace,
+                                      const bool unclipped) {
+              auto result = std::vector<kdl::result<Model::Brush, Model::BrushError>>{};
+              if (unclipped && preview) {
+                result.emplace_back(brush);
+              } else {
+                result.push_back(clip(brush, clipFace));
+              }
+              return result;
+            };
+
+            // the brushes are clipped independently of each other
+            auto clippedBrushes =
+              transformMaybeInParallel(brushNodes, [&](const Model::BrushNode* brushNode) {
+                const auto& brush = brushNode->brush();
+                switch (classifyBrush(brush, plane)) {
+                  case BrushSide::Below:
+                    return ClippedBrushes{clipOrKeep(brush, frontClipFace, true), {}};
+                  case BrushSide::Above:
+                    return ClippedBrushes{{}, clipOrKeep(brush, backClipFace, true)};
+                  case BrushSide::Both:
+                    return ClippedBrushes{
+                      clipOrKeep(brush, frontClipFace, false),
+                      clipOrKeep(brush, backClipFace, false)};
+                    switchDefault();
+                }
+              });
+
+            const auto addBrushes = [&](auto* parent, auto brushes, auto& brushMap) {
+              auto values =
+                kdl::collect_values(std::move(brushes), [&](const Model::BrushError e) {
+                  document->error() << "Could not clip brush: " << e;
+                });
+              for (auto& brush : values) {
+                brushMap[parent].push_back(new Model::BrushNode(std::move(brush)));
+              }
+            };
+
+            for (size_t i = 0u; i < brushNodes.size(); ++i) {
+              auto* parent = brushNodes[i]->parent();
+              addBrushes(parent, std::move(clippedBrushes[i].frontBrushes), m_frontBrushes);
+              addBrushes(parent, std::move(clippedBrushes[i].backBrushes), m_backBrushes);
+            }
+          });
+      })
+      .handle_errors([&](const Model::BrushError e) {
+        document->error() << "Could not create clip face: " << e;
+      });
   } else {
     for (auto* brushNode : brushNodes) {
       auto* parent = brushNode->parent();
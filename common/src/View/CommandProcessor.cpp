@@ -29,6 +29,7 @@
 #include <kdl/vector_utils.h>
 
 #include <algorithm>
+#include <iterator>
 
 #include <QDateTime>
 
@@ -108,14 +109,24 @@ private:
   }
 
   bool doCollateWith(UndoableCommand*) override { return false; }
+
+  size_t doGetMemoryUsage() const override {
+    auto result = sizeof(*this) + name().capacity();
+    for (const auto& command : m_commands) {
+      result += command->memoryUsage();
+    }
+    return result;
+  }
 };
 
 const Command::CommandType CommandProcessor::TransactionCommand::Type = Command::freeType();
 
 CommandProcessor::CommandProcessor(
-  MapDocumentCommandFacade* document, const std::chrono::milliseconds collationInterval)
+  MapDocumentCommandFacade* document, const std::chrono::milliseconds collationInterval,
+  const size_t memoryBudget)
   : m_document(document)
   , m_collationInterval(collationInterval)
+  , m_memoryBudget(memoryBudget)
   , m_lastCommandTimestamp(std::chrono::time_point<std::chrono::system_clock>()) {}
 
 CommandProcessor::~CommandProcessor() = default;
@@ -144,6 +155,26 @@ const std::string& CommandProcessor::redoCommandName() const {
   }
 }
 
+size_t CommandProcessor::memoryUsage() const {
+  auto result = size_t(0);
+  for (const auto& command : m_undoStack) {
+    result += command->memoryUsage();
+  }
+  for (const auto& command : m_redoStack) {
+    result += command->memoryUsage();
+  }
+  return result;
+}
+
+size_t CommandProcessor::memoryBudget() const {
+  return m_memoryBudget;
+}
+
+void CommandProcessor::setMemoryBudget(const size_t memoryBudget) {
+  m_memoryBudget = memoryBudget;
+  enforceMemoryBudget();
+}
+
 void CommandProcessor::startTransaction(const std::string& name) {
   m_transactionStack.push_back(TransactionState(name));
 }
@@ -230,8 +261,9 @@ CommandProcessor::SubmitAndStoreResult CommandProcessor::executeAndStoreCommand(
     return SubmitAndStoreResult(std::move(commandResult), false);
   }
 
-  const auto commandStored = storeCommand(std::move(command), collate);
+  // clear the redo stack first so that it doesn't count towards the memory budget
   m_redoStack.clear();
+  const auto commandStored = storeCommand(std::move(command), collate);
   return SubmitAndStoreResult(std::move(commandResult), commandStored);
 }
 
@@ -319,11 +351,13 @@ bool CommandProcessor::pushToUndoStack(
   if (collatable(collate, timestamp)) {
     auto& lastCommand = m_undoStack.back();
     if (lastCommand->collateWith(command.get())) {
+      enforceMemoryBudget();
       return false;
     }
   }
 
   m_undoStack.push_back(std::move(command));
+  enforceMemoryBudget();
   return true;
 }
 
@@ -351,5 +385,24 @@ std::unique_ptr<UndoableCommand> CommandProcessor::popFromRedoStack() {
 
   return kdl::vec_pop_back(m_redoStack);
 }
+
+void CommandProcessor::enforceMemoryBudget() {
+  auto usage = memoryUsage();
+
+  auto droppedCount = size_t(0);
+  auto droppedUsage = size_t(0);
+  while (usage > m_memoryBudget && droppedCount + 1u < m_undoStack.size()) {
+    const auto commandUsage = m_undoStack[droppedCount]->memoryUsage();
+    usage -= commandUsage;
+    droppedUsage += commandUsage;
+    ++droppedCount;
+  }
+
+  if (droppedCount > 0u) {
+    m_undoStack.erase(
+      std::begin(m_undoStack), std::next(std::begin(m_undoStack), long(droppedCount)));
+    commandsDroppedNotifier(droppedCount, droppedUsage);
+  }
+}
 } // namespace View
 } // namespace TrenchBroom
@@ -22,6 +22,8 @@
 #include "Notifier.h"
 
 #include <chrono>
+#include <cstddef>
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
@@ -47,6 +49,11 @@ class UndoableCommand;
  * The command processor supports nested transactions. Each transaction can be committed or rolled
  * back individually. Committing a nested transaction adds it as a command to the containing
  * transaction.
+ *
+ * The command processor keeps track of the memory used by the commands on the undo and the redo
+ * stack. If the memory usage exceeds the memory budget after a command was stored, the oldest
+ * commands are dropped from the undo stack until the memory usage is within the budget again. The
+ * most recently stored command is never dropped.
  */
 class CommandProcessor {
 private:
@@ -60,6 +67,12 @@ private:
    */
   std::chrono::milliseconds m_collationInterval;
 
+  /**
+   * The number of bytes that the commands on the undo and redo stacks may use before the oldest
+   * commands are dropped from the undo stack.
+   */
+  size_t m_memoryBudget;
+
   /**
    * Holds the commands that were executed so far, with the most recently executed command at the
    * end of the vector.
@@ -93,10 +106,13 @@ public:
    * executed or undone.
    *
    * @param document the document to pass to commands, may be null
+   * @param collationInterval the time after which succeeding commands are no longer collated
+   * @param memoryBudget the number of bytes the stored commands may use
    */
   explicit CommandProcessor(
     MapDocumentCommandFacade* document,
-    std::chrono::milliseconds collationInterval = std::chrono::milliseconds(1000));
+    std::chrono::milliseconds collationInterval = std::chrono::milliseconds(1000),
+    size_t memoryBudget = std::numeric_limits<size_t>::max());
 
   ~CommandProcessor();
 
@@ -139,6 +155,12 @@ public:
    */
   Notifier<const std::string&> transactionUndoneNotifier;
 
+  /**
+   * Notifies observers when commands were dropped from the undo stack because the memory budget was
+   * exceeded. Passes the number of dropped commands and the number of bytes they used.
+   */
+  Notifier<size_t, size_t> commandsDroppedNotifier;
+
   /**
    * Indicates whether there is any command on the undo stack.
    */
@@ -161,6 +183,24 @@ public:
    */
   const std::string& redoCommandName() const;
 
+  /**
+   * Returns an estimate of the number of bytes used by the commands on the undo and redo stacks.
+   */
+  size_t memoryUsage() const;
+
+  /**
+   * Returns the number of bytes the commands on the undo and redo stacks may use.
+   */
+  size_t memoryBudget() const;
+
+  /**
+   * Sets the number of bytes the commands on the undo and redo stacks may use. If the current
+   * memory usage exceeds the given budget, the oldest commands are dropped from the undo stack.
+   *
+   * @param memoryBudget the memory budget in bytes
+   */
+  void setMemoryBudget(size_t memoryBudget);
+
   /**
    * Starts a new transaction. If a transaction is currently executing, then the newly started
    * transaction becomes a nested transaction and will be added as a command to its parent
@@ -369,6 +409,13 @@ private:
    * @return the topmost command of the redo stack
    */
   std::unique_ptr<UndoableCommand> popFromRedoStack();
+
+  /**
+   * Drops the oldest commands from the undo stack until the memory usage of the undo and redo
+   * stacks does not exceed the memory budget. The topmost command of the undo stack is never
+   * dropped.
+   */
+  void enforceMemoryBudget();
 };
 } // namespace View
 } // namespace TrenchBroom
@@ -20,21 +20,18 @@
 #include "IssueBrowserView.h"
 
 #include "Ensure.h"
-#include "Model/BrushNode.h"
-#include "Model/EntityNode.h"
-#include "Model/GroupNode.h"
 #include "Model/Issue.h"
 #include "Model/IssueQuickFix.h"
-#include "Model/LayerNode.h"
-#include "Model/PatchNode.h"
+#include "Model/ModelUtils.h"
 #include "Model/WorldNode.h"
 #include "View/MapDocument.h"
 
 #include <kdl/memory_utils.h>
-#include <kdl/overload.h>
 #include <kdl/vector_set.h>
 #include <kdl/vector_utils.h>
 
+#include <iterator>
+#include <unordered_set>
 #include <vector>
 
 #include <QHBoxLayout>
@@ -119,38 +116,17 @@ void IssueBrowserView::updateIssues() {
   if (document->world() != nullptr) {
     const auto& issueGenerators = document->world()->registeredIssueGenerators();
 
+    const auto nodes = Model::collectNodes({document->world()});
+    Model::Node::validateIssues(nodes, issueGenerators);
+
     auto issues = std::vector<Model::Issue*>{};
-    const auto collectIssues = [&](auto* node) {
+    for (auto* node : nodes) {
       for (auto* issue : node->issues(issueGenerators)) {
         if (m_showHiddenIssues || (!issue->hidden() && (issue->type() & m_hiddenGenerators) == 0)) {
           issues.push_back(issue);
         }
       }
-    };
-
-    document->world()->accept(kdl::overload(
-      [&](auto&& thisLambda, Model::WorldNode* world) {
-        collectIssues(world);
-        world->visitChildren(thisLambda);
-      },
-      [&](auto&& thisLambda, Model::LayerNode* layer) {
-        collectIssues(layer);
-        layer->visitChildren(thisLambda);
-      },
-      [&](auto&& thisLambda, Model::GroupNode* group) {
-        collectIssues(group);
-        group->visitChildren(thisLambda);
-      },
-      [&](auto&& thisLambda, Model::EntityNode* entity) {
-        collectIssues(entity);
-        entity->visitChildren(thisLambda);
-      },
-      [&](Model::BrushNode* brush) {
-        collectIssues(brush);
-      },
-      [&](Model::PatchNode* patch) {
-        collectIssues(patch);
-      }));
+    }
 
     issues = kdl::vec_sort(std::move(issues), [](const auto* lhs, const auto* rhs) {
       return lhs->seqId() > rhs->seqId();
@@ -300,9 +276,60 @@ IssueBrowserModel::IssueBrowserModel(QObject* parent)
   , m_issues() {}
 
 void IssueBrowserModel::setIssues(std::vector<Model::Issue*> issues) {
-  beginResetModel();
-  m_issues = std::move(issues);
-  endResetModel();
+  // Only the issues of invalidated nodes are regenerated, all other issues keep their addresses.
+  // Remove the rows of the issues that are gone and insert rows for the new ones so that the view
+  // keeps its selection and scroll position. The old issues must not be dereferenced here since
+  // they may already have been deleted.
+  const auto newIssues = std::unordered_set<Model::Issue*>{std::begin(issues), std::end(issues)};
+  for (auto last = m_issues.size(); last > 0u;) {
+    if (newIssues.count(m_issues[last - 1u]) > 0u) {
+      --last;
+      continue;
+    }
+
+    auto first = last - 1u;
+    while (first > 0u && newIssues.count(m_issues[first - 1u]) == 0u) {
+      --first;
+    }
+    beginRemoveRows(QModelIndex{}, static_cast<int>(first), static_cast<int>(last - 1u));
+    m_issues.erase(
+      std::next(std::begin(m_issues), static_cast<long>(first)),
+      std::next(std::begin(m_issues), static_cast<long>(last)));
+    endRemoveRows();
+    last = first;
+  }
+
+  // both lists are sorted in the same order, so the new issues can be merged into the old ones
+  for (size_t first = 0u; first < issues.size();) {
+    if (first < m_issues.size() && m_issues[first] == issues[first]) {
+      ++first;
+      continue;
+    }
+
+    // insert all new issues up to the next remaining old issue
+    auto last = first + 1u;
+    while (last < issues.size() && (first >= m_issues.size() || m_issues[first] != issues[last])) {
+      ++last;
+    }
+    beginInsertRows(QModelIndex{}, static_cast<int>(first), static_cast<int>(last - 1u));
+    m_issues.insert(
+      std::next(std::begin(m_issues), static_cast<long>(first)),
+      std::next(std::begin(issues), static_cast<long>(first)),
+      std::next(std::begin(issues), static_cast<long>(last)));
+    endInsertRows();
+    first = last;
+  }
+
+  if (m_issues != issues) {
+    // a deleted issue's address was reused for a new issue, fall back to a full reset
+    beginResetModel();
+    m_issues = std::move(issues);
+    endResetModel();
+  } else if (!m_issues.empty()) {
+    // the hidden state of the remaining issues may have changed
+    emit dataChanged(
+      index(0, 0), index(static_cast<int>(m_issues.size()) - 1, columnCount(QModelIndex{}) - 1));
+  }
 }
 
 const std::vector<Model::Issue*>& IssueBrowserModel::issues() {
@@ -84,6 +84,7 @@
 #include "Model/VisibilityState.h"
 #include "Model/WorldBoundsIssueGenerator.h"
 #include "Model/WorldNode.h"
+#include "ParallelUtils.h"
 #include "PreferenceManager.h"
 #include "Preferences.h"
 #include "Uuid.h"
@@ -121,6 +122,7 @@
 #include <vecmath/vec_io.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstdlib> // for std::abs
 #include <map>
@@ -197,20 +199,21 @@ static auto findAllLinkedGroupsToUpdate(Model::WorldNode& worldNode, const std::
  * The given node contents should be modified in place and the lambda should return true if it was
  * applied successfully and false otherwise.
  *
- * Returns a vector of pairs which map each node to its modified contents if the lambda succeeded
- * for every given node, or an empty optional otherwise.
+ * Many nodes are processed in parallel, so the lambda must not modify any shared state without
+ * synchronizing, and it must not log or read preferences. If the lambda throws an exception, the
+ * exception is propagated to the caller.
+ *
+ * Returns a vector of pairs which map each node to its modified contents in the order of the given
+ * nodes if the lambda succeeded for every given node, or an empty optional otherwise.
  */
 template <typename N, typename L>
 static std::optional<std::vector<std::pair<Model::Node*, Model::NodeContents>>> applyToNodeContents(
   const std::vector<N*>& nodes, L lambda) {
   using NodeContentType =
     std::variant<Model::Layer, Model::Group, Model::Entity, Model::Brush, Model::BezierPatch>;
+  using NodeContentsResult = std::optional<std::pair<Model::Node*, Model::NodeContents>>;
 
-  auto newNodes = std::vector<std::pair<Model::Node*, Model::NodeContents>>{};
-  newNodes.reserve(nodes.size());
-
-  bool success = true;
-  std::transform(std::begin(nodes), std::end(nodes), std::back_inserter(newNodes), [&](auto* node) {
+  auto newNodes = transformMaybeInParallel(nodes, [&](auto* node) -> NodeContentsResult {
     NodeContentType nodeContents = node->accept(kdl::overload(
       [](const Model::WorldNode* worldNode) -> NodeContentType {
         return worldNode->entity();
@@ -231,11 +234,22 @@ static std::optional<std::vector<std::pair<Model::Node*, Model::NodeContents>>>
         return patchNode->patch();
       }));
 
-    success = success && std::visit(lambda, nodeContents);
+    if (!std::visit(lambda, nodeContents)) {
+      return std::nullopt;
+    }
     return std::make_pair(node, Model::NodeContents(std::move(nodeContents)));
   });
 
-  return success ? std::make_optional(newNodes) : std::nullopt;
+  const auto success = std::all_of(std::begin(newNodes), std::end(newNodes), [](const auto& p) {
+    return p.has_value();
+  });
+  if (!success) {
+    return std::nullopt;
+  }
+
+  return kdl::vec_transform(std::move(newNodes), [](auto&& p) {
+    return std::move(*p);
+  });
 }
 
 /**
@@ -288,6 +302,9 @@ static bool applyAndSwap(
  * The given node contents should be modified in place and the lambda should return true if it was
  * applied successfully and false otherwise.
  *
+ * Many brushes are processed in parallel, so the lambda must not modify any shared state. If the
+ * lambda throws an exception, the exception is propagated to the caller.
+ *
  * For each linked group in the given list of linked groups, its changes are distributed to the
  * connected members of its link set.
  *
@@ -303,26 +320,38 @@ static bool applyAndSwap(
     return true;
   }
 
-  auto brushes = std::unordered_map<Model::BrushNode*, Model::Brush>{};
-
-  bool success = true;
-  std::for_each(std::begin(faces), std::end(faces), [&](const auto& faceHandle) {
-    auto* brushNode = faceHandle.node();
-    auto it = brushes.find(brushNode);
-    if (it == std::end(brushes)) {
-      it = brushes.emplace(brushNode, brushNode->brush()).first;
+  // group the face indices by brush, keeping the order in which the brushes are encountered
+  auto brushNodes = std::vector<Model::BrushNode*>{};
+  auto faceIndices = std::unordered_map<Model::BrushNode*, std::vector<size_t>>{};
+  for (const auto& faceHandle : faces) {
+    auto [it, inserted] = faceIndices.try_emplace(faceHandle.node());
+    if (inserted) {
+      brushNodes.push_back(faceHandle.node());
     }
+    it->second.push_back(faceHandle.faceIndex());
+  }
+
+  auto brushes = transformMaybeInParallel(
+    brushNodes, [&](Model::BrushNode* brushNode) -> std::optional<Model::Brush> {
+      auto brush = brushNode->brush();
+      for (const auto faceIndex : faceIndices.at(brushNode)) {
+        if (!lambda(brush.face(faceIndex))) {
+          return std::nullopt;
+        }
+      }
+      return brush;
+    });
 
-    auto& brush = it->second;
-    success = success && lambda(brush.face(faceHandle.faceIndex()));
+  const auto success = std::all_of(std::begin(brushes), std::end(brushes), [](const auto& b) {
+    return b.has_value();
   });
 
   if (success) {
     auto newNodes = std::vector<std::pair<Model::Node*, Model::NodeContents>>{};
     newNodes.reserve(brushes.size());
 
-    for (auto& [brushNode, brush] : brushes) {
-      newNodes.emplace_back(brushNode, Model::NodeContents(std::move(brush)));
+    for (size_t i = 0u; i < brushNodes.size(); ++i) {
+      newNodes.emplace_back(brushNodes[i], Model::NodeContents(std::move(*brushes[i])));
     }
 
     auto linkedGroupsToUpdate = findContainingLinkedGroupsToUpdate(
@@ -2527,6 +2556,9 @@ bool MapDocument::csgConvexMerge() {
     }
   }
 
+  // adjacent brushes share many vertices, which need not be added to the hull more than once
+  points = kdl::vec_sort_and_remove_duplicates(std::move(points));
+
   Model::Polyhedron3 polyhedron(std::move(points));
   if (!polyhedron.polyhedron() || !polyhedron.closed()) {
     return false;
@@ -2582,15 +2614,23 @@ bool MapDocument::csgSubtract() {
     return &subtrahendNode->brush();
   });
 
+  // the minuends are independent of each other, so many of them can be processed in parallel
+  const auto mapFormat = m_world->mapFormat();
+  const auto& textureName = currentTextureName();
+  const bool mergeFragments = pref(Preferences::CSGMergeFragments);
+  auto subtractionResults =
+    transformMaybeInParallel(minuendNodes, [&](const Model::BrushNode* minuendNode) {
+      return minuendNode->brush().subtract(
+        mapFormat, m_worldBounds, textureName, subtrahends, mergeFragments);
+    });
+
   auto toAdd = std::map<Model::Node*, std::vector<Model::Node*>>{};
   auto toRemove = std::vector<Model::Node*>{std::begin(subtrahendNodes), std::end(subtrahendNodes)};
 
-  for (auto* minuendNode : minuendNodes) {
-    const Model::Brush& minuend = minuendNode->brush();
-    auto currentSubtractionResults =
-      minuend.subtract(m_world->mapFormat(), m_worldBounds, currentTextureName(), subtrahends);
+  for (size_t i = 0u; i < minuendNodes.size(); ++i) {
+    auto* minuendNode = minuendNodes[i];
     auto currentBrushes =
-      kdl::collect_values(std::move(currentSubtractionResults), [&](const Model::BrushError& e) {
+      kdl::collect_values(std::move(subtractionResults[i]), [&](const Model::BrushError& e) {
         error() << "Could not create brush: " << e;
       });
 
@@ -2654,32 +2694,46 @@ bool MapDocument::csgHollow() {
     return false;
   }
 
-  bool didHollowAnything = false;
-  std::vector<std::pair<Model::BrushNode*, std::vector<Model::Brush>>> fragmentsAndSourceNodes =
-    kdl::vec_transform(brushNodes, [&](Model::BrushNode* brushNode) {
+  // hollow many brushes in parallel, but log the errors and collect the fragments in order
+  const auto mapFormat = m_world->mapFormat();
+  const auto& textureName = currentTextureName();
+  const auto delta = -1.0 * static_cast<FloatType>(m_grid->actualSize());
+  const bool mergeFragments = pref(Preferences::CSGMergeFragments);
+  auto hollowResults =
+    transformMaybeInParallel(brushNodes, [&](const Model::BrushNode* brushNode) {
       const auto& originalBrush = brushNode->brush();
 
       auto shrunkenBrush = originalBrush;
-      std::vector<Model::Brush> fragments;
-      shrunkenBrush.expand(m_worldBounds, -1.0 * static_cast<FloatType>(m_grid->actualSize()), true)
-        .and_then([&]() {
-          didHollowAnything = true;
-
-          auto subtractionResults = originalBrush.subtract(
-            m_world->mapFormat(), m_worldBounds, currentTextureName(), shrunkenBrush);
-          fragments =
-            kdl::collect_values(std::move(subtractionResults), [&](const Model::BrushError& e) {
-              error() << "Could not create brush: " << e;
-            });
-        })
-        .handle_errors([&](const Model::BrushError& e) {
-          error() << "Could not hollow brush: " << e;
-          fragments = {originalBrush};
-        });
-
-      return std::make_pair(brushNode, std::move(fragments));
+      return shrunkenBrush.expand(m_worldBounds, delta, true).and_then([&]() {
+        return originalBrush.subtract(
+          mapFormat, m_worldBounds, textureName, shrunkenBrush, mergeFragments);
+      });
     });
 
+  bool didHollowAnything = false;
+  auto fragmentsAndSourceNodes =
+    std::vector<std::pair<Model::BrushNode*, std::vector<Model::Brush>>>{};
+  fragmentsAndSourceNodes.reserve(brushNodes.size());
+
+  for (size_t i = 0u; i < brushNodes.size(); ++i) {
+    auto* brushNode = brushNodes[i];
+    auto fragments = std::vector<Model::Brush>{};
+    std::move(hollowResults[i])
+      .and_then([&](auto&& subtractionResults) {
+        didHollowAnything = true;
+        fragments =
+          kdl::collect_values(std::move(subtractionResults), [&](const Model::BrushError& e) {
+            error() << "Could not create brush: " << e;
+          });
+      })
+      .handle_errors([&](const Model::BrushError& e) {
+        error() << "Could not hollow brush: " << e;
+        fragments = {brushNode->brush()};
+      });
+
+    fragmentsAndSourceNodes.emplace_back(brushNode, std::move(fragments));
+  }
+
   if (!didHollowAnything) {
     return false;
   }
@@ -2992,7 +3046,12 @@ bool MapDocument::canClearProtectedProperties() const {
 
 bool MapDocument::resizeBrushes(const std::vector<vm::polygon3>& faces, const vm::vec3& delta) {
   const auto nodes = m_selectedNodes.nodes();
-  return applyAndSwap(
+  const bool lockTextures = pref(Preferences::TextureLock);
+
+  auto errorMutex = std::mutex{};
+  auto errors = std::vector<Model::BrushError>{};
+
+  const auto success = applyAndSwap(
     *this, "Resize Brushes", nodes, findContainingLinkedGroupsToUpdate(*m_world, nodes),
     kdl::overload(
       [](Model::Layer&) {
@@ -3011,19 +3070,26 @@ bool MapDocument::resizeBrushes(const std::vector<vm::polygon3>& faces, const vm
           return true;
         }
 
-        return brush.moveBoundary(m_worldBounds, *faceIndex, delta, pref(Preferences::TextureLock))
+        return brush.moveBoundary(m_worldBounds, *faceIndex, delta, lockTextures)
           .visit(kdl::overload(
             [&]() {
               return m_worldBounds.contains(brush.bounds());
             },
             [&](const Model::BrushError e) {
-              error() << "Could not resize brush: " << e;
+              const auto lock = std::lock_guard<std::mutex>{errorMutex};
+              errors.push_back(e);
               return false;
             }));
       },
       [](Model::BezierPatch&) {
         return true;
       }));
+
+  for (const auto e : errors) {
+    error() << "Could not resize brush: " << e;
+  }
+
+  return success;
 }
 
 bool MapDocument::setFaceAttributes(const Model::BrushFaceAttributes& attributes) {
@@ -3095,9 +3161,13 @@ bool MapDocument::flipTextures(
 }
 
 bool MapDocument::snapVertices(const FloatType snapTo) {
-  size_t succeededBrushCount = 0;
-  size_t failedBrushCount = 0;
+  auto succeededBrushCount = std::atomic<size_t>{0};
+  auto failedBrushCount = std::atomic<size_t>{0};
 
+  auto errorMutex = std::mutex{};
+  auto errors = std::vector<Model::BrushError>{};
+
+  const bool uvLock = pref(Preferences::UVLock);
   const auto allSelectedBrushes = allSelectedBrushNodes();
   const bool applyAndSwapSuccess = applyAndSwap(
     *this, "Snap Brush Vertices", allSelectedBrushes,
@@ -3114,12 +3184,13 @@ bool MapDocument::snapVertices(const FloatType snapTo) {
       },
       [&](Model::Brush& originalBrush) {
         if (originalBrush.canSnapVertices(m_worldBounds, snapTo)) {
-          originalBrush.snapVertices(m_worldBounds, snapTo, pref(Preferences::UVLock))
+          originalBrush.snapVertices(m_worldBounds, snapTo, uvLock)
             .and_then([&]() {
               succeededBrushCount += 1;
             })
             .handle_errors([&](const Model::BrushError e) {
-              error() << "Could not snap vertices: " << e;
+              const auto lock = std::lock_guard<std::mutex>{errorMutex};
+              errors.push_back(e);
               failedBrushCount += 1;
             });
         } else {
@@ -3131,18 +3202,20 @@ bool MapDocument::snapVertices(const FloatType snapTo) {
         return true;
       }));
 
+  for (const auto e : errors) {
+    error() << "Could not snap vertices: " << e;
+  }
+
   if (!applyAndSwapSuccess) {
     return false;
   }
-  if (succeededBrushCount > 0) {
+  if (const size_t count = succeededBrushCount; count > 0) {
     info(kdl::str_to_string(
-      "Snapped vertices of ", succeededBrushCount, " ",
-      kdl::str_plural(succeededBrushCount, "brush", "brushes")));
+      "Snapped vertices of ", count, " ", kdl::str_plural(count, "brush", "brushes")));
   }
-  if (failedBrushCount > 0) {
+  if (const size_t count = failedBrushCount; count > 0) {
     info(kdl::str_to_string(
-      "Failed to snap vertices of ", failedBrushCount, " ",
-      kdl::str_plural(failedBrushCount, "brush", "brushes")));
+      "Failed to snap vertices of ", count, " ", kdl::str_plural(count, "brush", "brushes")));
   }
 
   return true;
@@ -3151,6 +3224,10 @@ bool MapDocument::snapVertices(const FloatType snapTo) {
 MapDocument::MoveVerticesResult MapDocument::moveVertices(
   std::vector<vm::vec3> vertexPositions, const vm::vec3& delta) {
   auto newVertexPositions = std::vector<vm::vec3>{};
+  auto errors = std::vector<Model::BrushError>{};
+  auto mutex = std::mutex{};
+
+  const bool uvLock = pref(Preferences::UVLock);
   auto newNodes = applyToNodeContents(
     m_selectedNodes.nodes(),
     kdl::overload(
@@ -3171,26 +3248,33 @@ MapDocument::MoveVerticesResult MapDocument::moveVertices(
           return true;
         }
 
-        if (!brush.canMoveVertices(m_worldBounds, verticesToMove, delta)) {
+        const auto canMoveResult = brush.validateMoveVertices(m_worldBounds, verticesToMove, delta);
+        if (!canMoveResult.success) {
           return false;
         }
 
-        return brush.moveVertices(m_worldBounds, verticesToMove, delta, pref(Preferences::UVLock))
+        return brush.moveVertices(m_worldBounds, verticesToMove, delta, canMoveResult, uvLock)
           .and_then([&]() {
             auto newPositions = brush.findClosestVertexPositions(verticesToMove + delta);
+            const auto lock = std::lock_guard<std::mutex>{mutex};
             newVertexPositions =
               kdl::vec_concat(std::move(newVertexPositions), std::move(newPositions));
           })
           .handle_errors([&](const Model::BrushError e) {
-            error() << "Could not move brush vertices: " << e;
+            const auto lock = std::lock_guard<std::mutex>{mutex};
+            errors.push_back(e);
           });
       },
       [](Model::BezierPatch&) {
         return true;
       }));
 
+  for (const auto e : errors) {
+    error() << "Could not move brush vertices: " << e;
+  }
+
   if (newNodes) {
-    kdl::vec_sort_and_remove_duplicates(newVertexPositions);
+    newVertexPositions = kdl::vec_sort_and_remove_duplicates(std::move(newVertexPositions));
 
     const auto commandName =
       kdl::str_plural(vertexPositions.size(), "Move Brush Vertex", "Move Brush Vertices");
@@ -3215,6 +3299,10 @@ MapDocument::MoveVerticesResult MapDocument::moveVertices(
 
 bool MapDocument::moveEdges(std::vector<vm::segment3> edgePositions, const vm::vec3& delta) {
   auto newEdgePositions = std::vector<vm::segment3>{};
+  auto errors = std::vector<Model::BrushError>{};
+  auto mutex = std::mutex{};
+
+  const bool uvLock = pref(Preferences::UVLock);
   auto newNodes = applyToNodeContents(
     m_selectedNodes.nodes(),
     kdl::overload(
@@ -3235,29 +3323,36 @@ bool MapDocument::moveEdges(std::vector<vm::segment3> edgePositions, const vm::v
           return true;
         }
 
-        if (!brush.canMoveEdges(m_worldBounds, edgesToMove, delta)) {
+        const auto canMoveResult = brush.validateMoveEdges(m_worldBounds, edgesToMove, delta);
+        if (!canMoveResult.success) {
           return false;
         }
 
-        return brush.moveEdges(m_worldBounds, edgesToMove, delta, pref(Preferences::UVLock))
+        return brush.moveEdges(m_worldBounds, edgesToMove, delta, canMoveResult, uvLock)
           .and_then([&]() {
             auto newPositions =
               brush.findClosestEdgePositions(kdl::vec_transform(edgesToMove, [&](const auto& edge) {
                 return edge.translate(delta);
               }));
+            const auto lock = std::lock_guard<std::mutex>{mutex};
             newEdgePositions =
               kdl::vec_concat(std::move(newEdgePositions), std::move(newPositions));
           })
           .handle_errors([&](const Model::BrushError e) {
-            error() << "Could not move brush edges: " << e;
+            const auto lock = std::lock_guard<std::mutex>{mutex};
+            errors.push_back(e);
           });
       },
       [](Model::BezierPatch&) {
         return true;
       }));
 
+  for (const auto e : errors) {
+    error() << "Could not move brush edges: " << e;
+  }
+
   if (newNodes) {
-    kdl::vec_sort_and_remove_duplicates(newEdgePositions);
+    newEdgePositions = kdl::vec_sort_and_remove_duplicates(std::move(newEdgePositions));
 
     const auto commandName =
       kdl::str_plural(edgePositions.size(), "Move Brush Edge", "Move Brush Edges");
@@ -3276,6 +3371,10 @@ bool MapDocument::moveEdges(std::vector<vm::segment3> edgePositions, const vm::v
 
 bool MapDocument::moveFaces(std::vector<vm::polygon3> facePositions, const vm::vec3& delta) {
   auto newFacePositions = std::vector<vm::polygon3>{};
+  auto errors = std::vector<Model::BrushError>{};
+  auto mutex = std::mutex{};
+
+  const bool uvLock = pref(Preferences::UVLock);
   auto newNodes = applyToNodeContents(
     m_selectedNodes.nodes(),
     kdl::overload(
@@ -3296,29 +3395,36 @@ bool MapDocument::moveFaces(std::vector<vm::polygon3> facePositions, const vm::v
           return true;
         }
 
-        if (!brush.canMoveFaces(m_worldBounds, facesToMove, delta)) {
+        const auto canMoveResult = brush.validateMoveFaces(m_worldBounds, facesToMove, delta);
+        if (!canMoveResult.success) {
           return false;
         }
 
-        return brush.moveFaces(m_worldBounds, facesToMove, delta, pref(Preferences::UVLock))
+        return brush.moveFaces(m_worldBounds, facesToMove, delta, canMoveResult, uvLock)
           .and_then([&]() {
             auto newPositions =
               brush.findClosestFacePositions(kdl::vec_transform(facesToMove, [&](const auto& face) {
                 return face.translate(delta);
               }));
+            const auto lock = std::lock_guard<std::mutex>{mutex};
             newFacePositions =
               kdl::vec_concat(std::move(newFacePositions), std::move(newPositions));
           })
           .handle_errors([&](const Model::BrushError e) {
-            error() << "Could not move brush faces: " << e;
+            const auto lock = std::lock_guard<std::mutex>{mutex};
+            errors.push_back(e);
           });
       },
       [](Model::BezierPatch&) {
         return true;
       }));
 
+  for (const auto e : errors) {
+    error() << "Could not move brush faces: " << e;
+  }
+
   if (newNodes) {
-    kdl::vec_sort_and_remove_duplicates(newFacePositions);
+    newFacePositions = kdl::vec_sort_and_remove_duplicates(std::move(newFacePositions));
 
     const auto commandName =
       kdl::str_plural(facePositions.size(), "Move Brush Face", "Move Brush Faces");
@@ -3336,6 +3442,9 @@ bool MapDocument::moveFaces(std::vector<vm::polygon3> facePositions, const vm::v
 }
 
 bool MapDocument::addVertex(const vm::vec3& vertexPosition) {
+  auto errors = std::vector<Model::BrushError>{};
+  auto errorMutex = std::mutex{};
+
   auto newNodes = applyToNodeContents(
     m_selectedNodes.nodes(), kdl::overload(
                                [](Model::Layer&) {
@@ -3354,13 +3463,18 @@ bool MapDocument::addVertex(const vm::vec3& vertexPosition) {
 
                                  return brush.addVertex(m_worldBounds, vertexPosition)
                                    .handle_errors([&](const Model::BrushError e) {
-                                     error() << "Could not add brush vertex: " << e;
+                                     const auto lock = std::lock_guard<std::mutex>{errorMutex};
+                                     errors.push_back(e);
                                    });
                                },
                                [](Model::BezierPatch&) {
                                  return true;
                                }));
 
+  for (const auto e : errors) {
+    error() << "Could not add brush vertex: " << e;
+  }
+
   if (newNodes) {
     auto linkedGroupsToUpdate =
       findContainingLinkedGroupsToUpdate(*m_world, kdl::vec_transform(*newNodes, [](const auto& p) {
@@ -3378,6 +3492,9 @@ bool MapDocument::addVertex(const vm::vec3& vertexPosition) {
 
 bool MapDocument::removeVertices(
   const std::string& commandName, std::vector<vm::vec3> vertexPositions) {
+  auto errors = std::vector<Model::BrushError>{};
+  auto errorMutex = std::mutex{};
+
   auto newNodes = applyToNodeContents(
     m_selectedNodes.nodes(), kdl::overload(
                                [](Model::Layer&) {
@@ -3404,13 +3521,18 @@ bool MapDocument::removeVertices(
 
                                  return brush.removeVertices(m_worldBounds, verticesToRemove)
                                    .handle_errors([&](const Model::BrushError e) {
-                                     error() << "Could not remove brush vertices: " << e;
+                                     const auto lock = std::lock_guard<std::mutex>{errorMutex};
+                                     errors.push_back(e);
                                    });
                                },
                                [](Model::BezierPatch&) {
                                  return true;
                                }));
 
+  for (const auto e : errors) {
+    error() << "Could not remove brush vertices: " << e;
+  }
+
   if (newNodes) {
     auto linkedGroupsToUpdate =
       findContainingLinkedGroupsToUpdate(*m_world, kdl::vec_transform(*newNodes, [](const auto& p) {
@@ -3493,6 +3615,10 @@ const std::string& MapDocument::redoCommandName() const {
   return doGetRedoCommandName();
 }
 
+size_t MapDocument::commandHistoryMemoryUsage() const {
+  return doGetCommandHistoryMemoryUsage();
+}
+
 void MapDocument::undoCommand() {
   doUndoCommand();
   // Undo/redo in the repeat system is not supported for now, so just clear the repeat stack
@@ -149,6 +149,7 @@ public: // notification
   Notifier<UndoableCommand*> commandUndoFailedNotifier;
   Notifier<const std::string&> transactionDoneNotifier;
   Notifier<const std::string&> transactionUndoneNotifier;
+  Notifier<size_t> undoStepsDroppedNotifier;
 
   Notifier<MapDocument*> documentWillBeClearedNotifier;
   Notifier<MapDocument*> documentWasClearedNotifier;
@@ -591,6 +592,7 @@ public: // command processing
   bool canRedoCommand() const;
   const std::string& undoCommandName() const;
   const std::string& redoCommandName() const;
+  size_t commandHistoryMemoryUsage() const;
   void undoCommand();
   void redoCommand();
   bool canRepeatCommands() const;
@@ -612,6 +614,7 @@ private: // subclassing interface for command processing
   virtual bool doCanRedoCommand() const = 0;
   virtual const std::string& doGetUndoCommandName() const = 0;
   virtual const std::string& doGetRedoCommandName() const = 0;
+  virtual size_t doGetCommandHistoryMemoryUsage() const = 0;
   virtual void doUndoCommand() = 0;
   virtual void doRedoCommand() = 0;
 
@@ -54,6 +54,8 @@
 #include <vecmath/polygon.h>
 #include <vecmath/segment.h>
 
+#include <chrono>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
@@ -66,8 +68,15 @@ std::shared_ptr<MapDocument> MapDocumentCommandFacade::newMapDocument() {
   return std::shared_ptr<MapDocument>(new MapDocumentCommandFacade());
 }
 
+static size_t undoMemoryBudget() {
+  const auto budgetInMiB = pref(Preferences::UndoMemoryBudget);
+  return budgetInMiB > 0 ? size_t(budgetInMiB) * 1024u * 1024u
+                         : std::numeric_limits<size_t>::max();
+}
+
 MapDocumentCommandFacade::MapDocumentCommandFacade()
-  : m_commandProcessor(std::make_unique<CommandProcessor>(this)) {
+  : m_commandProcessor(std::make_unique<CommandProcessor>(
+      this, std::chrono::milliseconds(1000), undoMemoryBudget())) {
   connectObservers();
 }
 
@@ -371,6 +380,9 @@ void MapDocumentCommandFacade::performSwapNodeContents(
     entityDefinitionsDidChangeNotifier);
   NotifyBeforeAndAfter notifyMods(notifyModsChange, modsWillChangeNotifier, modsDidChangeNotifier);
 
+  // update the node tree once for all nodes whose bounds change
+  Model::WorldNode::NodeTreeBatch nodeTreeBatch(*m_world);
+
   for (auto& pair : nodesToSwap) {
     auto* node = pair.first;
     auto& contents = pair.second.get();
@@ -410,6 +422,7 @@ void MapDocumentCommandFacade::performSwapNodeContents(
     setTextures(nodes);
   }
 
+  nodeTreeBatch.end();
   invalidateSelectionBounds();
 }
 
@@ -538,6 +551,25 @@ void MapDocumentCommandFacade::connectObservers() {
     m_commandProcessor->transactionDoneNotifier.connect(transactionDoneNotifier);
   m_notifierConnection +=
     m_commandProcessor->transactionUndoneNotifier.connect(transactionUndoneNotifier);
+  m_notifierConnection += m_commandProcessor->commandsDroppedNotifier.connect(
+    this, &MapDocumentCommandFacade::commandsDropped);
+
+  auto& prefs = PreferenceManager::instance();
+  m_notifierConnection += prefs.preferenceDidChangeNotifier.connect(
+    this, &MapDocumentCommandFacade::preferenceDidChange);
+}
+
+void MapDocumentCommandFacade::commandsDropped(const size_t count, const size_t memoryUsage) {
+  info() << "Dropped " << count << " undo " << kdl::str_plural(count, "step", "steps")
+         << " to free " << (memoryUsage / 1024u) << " KiB; undo history uses "
+         << (m_commandProcessor->memoryUsage() / 1024u) << " KiB";
+  undoStepsDroppedNotifier(count);
+}
+
+void MapDocumentCommandFacade::preferenceDidChange(const IO::Path& path) {
+  if (path == Preferences::UndoMemoryBudget.path()) {
+    m_commandProcessor->setMemoryBudget(undoMemoryBudget());
+  }
 }
 
 bool MapDocumentCommandFacade::doCanUndoCommand() const {
@@ -556,6 +588,10 @@ const std::string& MapDocumentCommandFacade::doGetRedoCommandName() const {
   return m_commandProcessor->redoCommandName();
 }
 
+size_t MapDocumentCommandFacade::doGetCommandHistoryMemoryUsage() const {
+  return m_commandProcessor->memoryUsage();
+}
+
 void MapDocumentCommandFacade::doUndoCommand() {
   m_commandProcessor->undo();
 }
@@ -132,12 +132,15 @@ private: // notification
   void connectObservers();
   void documentWasNewed(MapDocument* document);
   void documentWasLoaded(MapDocument* document);
+  void commandsDropped(size_t count, size_t memoryUsage);
+  void preferenceDidChange(const IO::Path& path);
 
 private: // implement MapDocument interface
   bool doCanUndoCommand() const override;
   bool doCanRedoCommand() const override;
   const std::string& doGetUndoCommandName() const override;
   const std::string& doGetRedoCommandName() const override;
+  size_t doGetCommandHistoryMemoryUsage() const override;
   void doUndoCommand() override;
   void doRedoCommand() override;
 
@@ -94,6 +94,7 @@
 #include <QFileDialog>
 #include <QInputDialog>
 #include <QLabel>
+#include <QLocale>
 #include <QMessageBox>
 #include <QMimeData>
 #include <QPushButton>
@@ -291,6 +292,9 @@ void MapFrame::updateUndoRedoActions() {
       m_undoAction->setText("Undo");
       m_undoAction->setEnabled(false);
     }
+    m_undoAction->setStatusTip(
+      tr("Undo history uses %1")
+        .arg(QLocale{}.formattedDataSize(qint64(document->commandHistoryMemoryUsage()))));
   }
   if (m_redoAction != nullptr) {
     if (document->canRedoCommand()) {
@@ -684,6 +688,8 @@ void MapFrame::connectObservers() {
     m_document->transactionDoneNotifier.connect(this, &MapFrame::transactionDone);
   m_notifierConnection +=
     m_document->transactionUndoneNotifier.connect(this, &MapFrame::transactionUndone);
+  m_notifierConnection +=
+    m_document->undoStepsDroppedNotifier.connect(this, &MapFrame::undoStepsDropped);
   m_notifierConnection +=
     m_document->selectionDidChangeNotifier.connect(this, &MapFrame::selectionDidChange);
   m_notifierConnection +=
@@ -752,6 +758,13 @@ void MapFrame::transactionUndone(const std::string& /* name */) {
   });
 }
 
+void MapFrame::undoStepsDropped(const size_t count) {
+  statusBar()->showMessage(
+    tr("Dropped the oldest %1 to stay within the undo memory budget")
+      .arg(QString::fromStdString(numberWithSuffix(count, "undo step", "undo steps"))),
+    10000);
+}
+
 void MapFrame::preferenceDidChange(const IO::Path& path) {
   if (path == Preferences::MapViewLayout.path()) {
     m_mapView->switchToMapView(static_cast<MapViewLayout>(pref(Preferences::MapViewLayout)));
@@ -1599,6 +1612,10 @@ bool MapFrame::canDoCsgIntersect() const {
          m_document->selectedNodes().brushCount() > 1;
 }
 
+void MapFrame::toggleCsgMergeFragments() {
+  togglePref(Preferences::CSGMergeFragments);
+}
+
 void MapFrame::snapVerticesToInteger() {
   if (canSnapVertices()) {
     m_document->snapVertices(1u);
@@ -173,6 +173,7 @@ private: // notification handlers
 
   void transactionDone(const std::string&);
   void transactionUndone(const std::string&);
+  void undoStepsDropped(size_t count);
 
   void preferenceDidChange(const IO::Path& path);
   void gridDidChange();
@@ -322,6 +323,7 @@ public:
 
   void csgIntersect();
   bool canDoCsgIntersect() const;
+  void toggleCsgMergeFragments();
 
   void snapVerticesToInteger();
   void snapVerticesToGrid();
@@ -65,6 +65,8 @@
 #include <kdl/overload.h>
 #include <kdl/result.h>
 
+#include <vecmath/bbox.h>
+#include <vecmath/mat.h>
 #include <vecmath/util.h>
 
 #include <memory>
@@ -342,7 +344,8 @@ void MapView2D::doRenderMap(
 
   auto document = kdl::mem_lock(m_document);
   if (renderContext.showSelectionGuide() && document->hasSelectedNodes()) {
-    const vm::bbox3& bounds = document->selectionBounds();
+    const auto bounds =
+      document->selectionBounds().transform(renderContext.selectionTransformation());
     Renderer::SelectionBoundsRenderer boundsRenderer(bounds);
     boundsRenderer.render(renderContext, renderBatch);
   }
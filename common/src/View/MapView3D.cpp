@@ -70,6 +70,8 @@
 
 #include <kdl/set_temp.h>
 
+#include <vecmath/bbox.h>
+#include <vecmath/mat.h>
 #include <vecmath/util.h>
 
 #include <memory>
@@ -476,7 +478,8 @@ void MapView3D::doRenderMap(
 
   auto document = kdl::mem_lock(m_document);
   if (renderContext.showSelectionGuide() && document->hasSelectedNodes()) {
-    const vm::bbox3& bounds = document->selectionBounds();
+    const auto bounds =
+      document->selectionBounds().transform(renderContext.selectionTransformation());
     Renderer::SelectionBoundsRenderer boundsRenderer(bounds);
     boundsRenderer.render(renderContext, renderBatch);
 
@@ -29,6 +29,8 @@
 #include <kdl/memory_utils.h>
 
 #include <vecmath/bbox.h>
+#include <vecmath/mat_ext.h>
+#include <vecmath/vec.h>
 
 #include <cassert>
 
@@ -37,7 +39,8 @@ namespace View {
 MoveObjectsTool::MoveObjectsTool(std::weak_ptr<MapDocument> document)
   : Tool(true)
   , m_document(document)
-  , m_duplicateObjects(false) {}
+  , m_duplicateObjects(false)
+  , m_delta(vm::vec3::zero()) {}
 
 const Grid& MoveObjectsTool::grid() const {
   return kdl::mem_lock(m_document)->grid();
@@ -52,6 +55,7 @@ bool MoveObjectsTool::startMove(const InputState& inputState) {
 
   document->startTransaction(duplicateObjects(inputState) ? "Duplicate Objects" : "Move Objects");
   m_duplicateObjects = duplicateObjects(inputState);
+  m_delta = vm::vec3::zero();
   return true;
 }
 
@@ -59,7 +63,7 @@ MoveObjectsTool::MoveResult MoveObjectsTool::move(const InputState&, const vm::v
   auto document = kdl::mem_lock(m_document);
   const auto& worldBounds = document->worldBounds();
   const auto bounds = document->selectionBounds();
-  if (!worldBounds.contains(bounds.translate(delta))) {
+  if (!worldBounds.contains(bounds.translate(m_delta + delta))) {
     return MR_Deny;
   }
 
@@ -68,21 +72,33 @@ MoveObjectsTool::MoveResult MoveObjectsTool::move(const InputState&, const vm::v
     document->duplicateObjects();
   }
 
-  if (!document->translateObjects(delta)) {
-    return MR_Deny;
-  } else {
-    return MR_Continue;
-  }
+  m_delta = m_delta + delta;
+  refreshViews();
+  return MR_Continue;
 }
 
 void MoveObjectsTool::endMove(const InputState&) {
   auto document = kdl::mem_lock(m_document);
-  document->commitTransaction();
+  const auto delta = m_delta;
+  m_delta = vm::vec3::zero();
+
+  if (!vm::is_zero(delta, vm::C::almost_zero()) && !document->translateObjects(delta)) {
+    document->cancelTransaction();
+  } else {
+    document->commitTransaction();
+  }
+  refreshViews();
 }
 
 void MoveObjectsTool::cancelMove() {
   auto document = kdl::mem_lock(m_document);
+  m_delta = vm::vec3::zero();
   document->cancelTransaction();
+  refreshViews();
+}
+
+vm::mat4x4 MoveObjectsTool::previewTransformation() const {
+  return vm::translation_matrix(m_delta);
 }
 
 bool MoveObjectsTool::duplicateObjects(const InputState& inputState) const {
@@ -22,6 +22,9 @@
 #include "FloatType.h"
 #include "View/Tool.h"
 
+#include <vecmath/mat.h>
+#include <vecmath/vec.h>
+
 #include <memory>
 
 namespace TrenchBroom {
@@ -41,6 +44,7 @@ public:
 private:
   std::weak_ptr<MapDocument> m_document;
   bool m_duplicateObjects;
+  vm::vec3 m_delta;
 
 public:
   explicit MoveObjectsTool(std::weak_ptr<MapDocument> document);
@@ -53,6 +57,13 @@ public:
   void endMove(const InputState& inputState);
   void cancelMove();
 
+  /**
+   * Returns the translation of the selected objects that has been accumulated during the current
+   * move, but not yet applied to the document. The objects are only translated when the move
+   * ends.
+   */
+  vm::mat4x4 previewTransformation() const;
+
 private:
   bool duplicateObjects(const InputState& inputState) const;
 
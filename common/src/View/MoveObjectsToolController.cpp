@@ -27,6 +27,8 @@
 #include "View/MoveHandleDragTracker.h"
 #include "View/MoveObjectsTool.h"
 
+#include <vecmath/mat.h>
+
 #include <cassert>
 
 namespace TrenchBroom {
@@ -110,6 +112,15 @@ std::unique_ptr<DragTracker> MoveObjectsToolController::acceptMouseDrag(
     MoveObjectsDragDelegate{m_tool}, inputState, hit.hitPoint(), vm::vec3::zero());
 }
 
+void MoveObjectsToolController::setRenderOptions(
+  const InputState&, Renderer::RenderContext& renderContext) const {
+  // other views render the preview, too, so this cannot be done by the drag delegate
+  const auto transformation = m_tool.previewTransformation();
+  if (transformation != vm::mat4x4::identity()) {
+    renderContext.setSelectionTransformation(transformation);
+  }
+}
+
 bool MoveObjectsToolController::cancel() {
   return false;
 }
@@ -40,6 +40,9 @@ private:
 
   std::unique_ptr<DragTracker> acceptMouseDrag(const InputState& inputState) override;
 
+  void setRenderOptions(
+    const InputState& inputState, Renderer::RenderContext& renderContext) const override;
+
   bool cancel() override;
 };
 } // namespace View
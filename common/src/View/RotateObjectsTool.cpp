@@ -28,6 +28,8 @@
 #include <kdl/memory_utils.h>
 #include <kdl/vector_utils.h>
 
+#include <vecmath/mat.h>
+#include <vecmath/mat_ext.h>
 #include <vecmath/scalar.h>
 
 namespace TrenchBroom {
@@ -37,7 +39,8 @@ RotateObjectsTool::RotateObjectsTool(std::weak_ptr<MapDocument> document)
   , m_document(document)
   , m_toolPage(nullptr)
   , m_handle()
-  , m_angle(vm::to_radians(15.0)) {}
+  , m_angle(vm::to_radians(15.0))
+  , m_rotation(vm::mat4x4::identity()) {}
 
 bool RotateObjectsTool::doActivate() {
   resetRotationCenter();
@@ -94,17 +97,30 @@ FloatType RotateObjectsTool::minorHandleRadius(const Renderer::Camera& camera) c
 void RotateObjectsTool::beginRotation() {
   auto document = kdl::mem_lock(m_document);
   document->startTransaction("Rotate Objects");
+  m_rotation = vm::mat4x4::identity();
 }
 
 void RotateObjectsTool::commitRotation() {
   auto document = kdl::mem_lock(m_document);
-  document->commitTransaction();
-  updateRecentlyUsedCenters(rotationCenter());
+  const auto rotation = m_rotation;
+  m_rotation = vm::mat4x4::identity();
+
+  if (
+    rotation != vm::mat4x4::identity() &&
+    !document->transformObjects("Rotate Objects", rotation)) {
+    document->cancelTransaction();
+  } else {
+    document->commitTransaction();
+    updateRecentlyUsedCenters(rotationCenter());
+  }
+  refreshViews();
 }
 
 void RotateObjectsTool::cancelRotation() {
   auto document = kdl::mem_lock(m_document);
+  m_rotation = vm::mat4x4::identity();
   document->cancelTransaction();
+  refreshViews();
 }
 
 FloatType RotateObjectsTool::snapRotationAngle(const FloatType angle) const {
@@ -114,9 +130,13 @@ FloatType RotateObjectsTool::snapRotationAngle(const FloatType angle) const {
 
 void RotateObjectsTool::applyRotation(
   const vm::vec3& center, const vm::vec3& axis, const FloatType angle) {
-  auto document = kdl::mem_lock(m_document);
-  document->rollbackTransaction();
-  document->rotateObjects(center, axis, angle);
+  m_rotation = vm::translation_matrix(center) * vm::rotation_matrix(axis, angle) *
+               vm::translation_matrix(-center);
+  refreshViews();
+}
+
+const vm::mat4x4& RotateObjectsTool::previewTransformation() const {
+  return m_rotation;
 }
 
 Model::Hit RotateObjectsTool::pick2D(const vm::ray3& pickRay, const Renderer::Camera& camera) {
@@ -24,6 +24,7 @@
 #include "View/Tool.h"
 
 #include <vecmath/forward.h>
+#include <vecmath/mat.h>
 
 #include <memory>
 #include <vector>
@@ -47,6 +48,7 @@ private:
   RotateObjectsHandle m_handle;
   double m_angle;
   std::vector<vm::vec3> m_recentlyUsedCenters;
+  vm::mat4x4 m_rotation;
 
 public:
   explicit RotateObjectsTool(std::weak_ptr<MapDocument> document);
@@ -74,6 +76,12 @@ public:
   FloatType snapRotationAngle(FloatType angle) const;
   void applyRotation(const vm::vec3& center, const vm::vec3& axis, FloatType angle);
 
+  /**
+   * Returns the rotation of the selected objects during the current drag. The rotation is only
+   * applied to the document when the drag is committed.
+   */
+  const vm::mat4x4& previewTransformation() const;
+
   Model::Hit pick2D(const vm::ray3& pickRay, const Renderer::Camera& camera);
   Model::Hit pick3D(const vm::ray3& pickRay, const Renderer::Camera& camera);
 
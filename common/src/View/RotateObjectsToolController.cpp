@@ -39,6 +39,7 @@
 #include "View/ToolController.h"
 
 #include <vecmath/intersection.h>
+#include <vecmath/mat.h>
 #include <vecmath/mat_ext.h>
 #include <vecmath/quat.h>
 #include <vecmath/util.h>
@@ -465,6 +466,11 @@ void RotateObjectsToolController::setRenderOptions(
   if (inputState.pickResult().first(type(RotateObjectsHandle::HandleHitType)).isMatch()) {
     renderContext.setForceShowSelectionGuide();
   }
+
+  const auto& transformation = m_tool.previewTransformation();
+  if (transformation != vm::mat4x4::identity()) {
+    renderContext.setSelectionTransformation(transformation);
+  }
 }
 
 void RotateObjectsToolController::render(
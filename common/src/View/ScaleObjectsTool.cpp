@@ -38,6 +38,8 @@
 #include <vecmath/distance.h>
 #include <vecmath/intersection.h>
 #include <vecmath/line.h>
+#include <vecmath/mat.h>
+#include <vecmath/mat_ext.h>
 #include <vecmath/vec.h>
 #include <vecmath/vec_io.h>
 
@@ -465,6 +467,7 @@ ScaleObjectsTool::ScaleObjectsTool(std::weak_ptr<MapDocument> document)
   , m_resizing(false)
   , m_anchorPos(AnchorPos::Opposite)
   , m_bboxAtDragStart()
+  , m_bboxAtDragEnd()
   , m_dragStartHit(Model::Hit::NoHit)
   , m_dragCumulativeDelta(vm::vec3::zero())
   , m_proportionalAxes(ProportionalAxes::None()) {}
@@ -645,6 +648,10 @@ void ScaleObjectsTool::pick3D(
 }
 
 vm::bbox3 ScaleObjectsTool::bounds() const {
+  if (m_resizing) {
+    return m_bboxAtDragEnd;
+  }
+
   auto document = kdl::mem_lock(m_document);
   return document->selectionBounds();
 }
@@ -834,6 +841,12 @@ vm::bbox3 ScaleObjectsTool::bboxAtDragStart() const {
   return m_bboxAtDragStart;
 }
 
+vm::mat4x4 ScaleObjectsTool::previewTransformation() const {
+  return m_resizing && m_bboxAtDragEnd != m_bboxAtDragStart
+           ? vm::scale_bbox_matrix(m_bboxAtDragStart, m_bboxAtDragEnd)
+           : vm::mat4x4::identity();
+}
+
 std::vector<vm::vec3> ScaleObjectsTool::cornerHandles() const {
   if (bounds().is_empty()) {
     return {};
@@ -900,6 +913,7 @@ void ScaleObjectsTool::startScaleWithHit(const Model::Hit& hit) {
   ensure(!m_resizing, "must not be resizing already");
 
   m_bboxAtDragStart = bounds();
+  m_bboxAtDragEnd = m_bboxAtDragStart;
   m_dragStartHit = hit;
   m_dragCumulativeDelta = vm::vec3::zero();
 
@@ -913,30 +927,35 @@ void ScaleObjectsTool::scaleByDelta(const vm::vec3& delta) {
 
   m_dragCumulativeDelta = m_dragCumulativeDelta + delta;
 
-  auto document = kdl::mem_lock(m_document);
-
   const auto newBox = moveBBoxForHit(
     m_bboxAtDragStart, m_dragStartHit, m_dragCumulativeDelta, m_proportionalAxes, m_anchorPos);
 
   if (!newBox.is_empty()) {
-    document->scaleObjects(bounds(), newBox);
+    m_bboxAtDragEnd = newBox;
+    refreshViews();
   }
 }
 
 void ScaleObjectsTool::commitScale() {
   auto document = kdl::mem_lock(m_document);
-  if (vm::is_zero(m_dragCumulativeDelta, vm::C::almost_zero())) {
+  m_resizing = false;
+
+  if (
+    vm::is_zero(m_dragCumulativeDelta, vm::C::almost_zero()) ||
+    m_bboxAtDragEnd == m_bboxAtDragStart ||
+    !document->scaleObjects(m_bboxAtDragStart, m_bboxAtDragEnd)) {
     document->cancelTransaction();
   } else {
     document->commitTransaction();
   }
-  m_resizing = false;
+  refreshViews();
 }
 
 void ScaleObjectsTool::cancelScale() {
   auto document = kdl::mem_lock(m_document);
-  document->cancelTransaction();
   m_resizing = false;
+  document->cancelTransaction();
+  refreshViews();
 }
 
 QWidget* ScaleObjectsTool::doCreatePage(QWidget* parent) {
@@ -26,6 +26,7 @@
 #include "View/Tool.h"
 
 #include <vecmath/bbox.h>
+#include <vecmath/mat.h>
 #include <vecmath/vec.h>
 
 #include <bitset>
@@ -210,6 +211,7 @@ private:
   bool m_resizing;
   AnchorPos m_anchorPos;
   vm::bbox3 m_bboxAtDragStart;
+  vm::bbox3 m_bboxAtDragEnd;
   Model::Hit m_dragStartHit; // contains the drag type (side/edge/corner)
   vm::vec3 m_dragCumulativeDelta;
   ProportionalAxes m_proportionalAxes;
@@ -255,6 +257,13 @@ public:
    */
   vm::bbox3 bboxAtDragStart() const;
 
+  /**
+   * Returns the transformation that maps the bbox at the start of the drag to the current bbox.
+   * The selected objects are only scaled when the drag is committed, until then this
+   * transformation is used to preview the result.
+   */
+  vm::mat4x4 previewTransformation() const;
+
   std::vector<vm::vec3> cornerHandles() const;
 
   void updatePickedHandle(const Model::PickResult& pickResult);
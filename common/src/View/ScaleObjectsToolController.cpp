@@ -36,6 +36,7 @@
 #include "kdl/vector_utils.h"
 #include <kdl/memory_utils.h>
 
+#include <vecmath/mat.h>
 #include <vecmath/polygon.h>
 #include <vecmath/segment.h>
 
@@ -218,6 +219,11 @@ std::unique_ptr<DragTracker> ScaleObjectsToolController::acceptMouseDrag(
 void ScaleObjectsToolController::setRenderOptions(
   const InputState&, Renderer::RenderContext& renderContext) const {
   renderContext.setForceHideSelectionGuide();
+
+  const auto transformation = m_tool.previewTransformation();
+  if (transformation != vm::mat4x4::identity()) {
+    renderContext.setSelectionTransformation(transformation);
+  }
 }
 
 static void renderBounds(
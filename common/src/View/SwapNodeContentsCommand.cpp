@@ -28,6 +28,8 @@
 #include <kdl/result.h>
 #include <kdl/vector_utils.h>
 
+#include <unordered_map>
+
 namespace TrenchBroom {
 namespace View {
 const Command::CommandType SwapNodeContentsCommand::Type = Command::freeType();
@@ -37,19 +39,23 @@ SwapNodeContentsCommand::SwapNodeContentsCommand(
   std::vector<std::pair<const Model::GroupNode*, std::vector<Model::GroupNode*>>>
     linkedGroupsToUpdate)
   : UndoableCommand(Type, name, true)
-  , m_nodes(std::move(nodes))
-  , m_updateLinkedGroupsHelper(std::move(linkedGroupsToUpdate)) {}
+  , m_updateLinkedGroupsHelper(std::move(linkedGroupsToUpdate)) {
+  m_nodes.reserve(nodes.size());
+  for (auto& [node, contents] : nodes) {
+    m_nodes.emplace_back(node, Model::NodeContentsDelta::create(*node, std::move(contents)));
+  }
+}
 
 SwapNodeContentsCommand::~SwapNodeContentsCommand() = default;
 
 std::unique_ptr<CommandResult> SwapNodeContentsCommand::doPerformDo(
   MapDocumentCommandFacade* document) {
-  document->performSwapNodeContents(m_nodes);
+  swapNodeContents(document);
 
   const auto success = m_updateLinkedGroupsHelper.applyLinkedGroupUpdates(*document).handle_errors(
     [&](const Model::UpdateLinkedGroupsError& e) {
       document->error() << e;
-      document->performSwapNodeContents(m_nodes);
+      swapNodeContents(document);
     });
 
   return std::make_unique<CommandResult>(success);
@@ -57,7 +63,7 @@ std::unique_ptr<CommandResult> SwapNodeContentsCommand::doPerformDo(
 
 std::unique_ptr<CommandResult> SwapNodeContentsCommand::doPerformUndo(
   MapDocumentCommandFacade* document) {
-  document->performSwapNodeContents(m_nodes);
+  swapNodeContents(document);
   m_updateLinkedGroupsHelper.undoLinkedGroupUpdates(*document);
   return std::make_unique<CommandResult>(true);
 }
@@ -76,11 +82,50 @@ bool SwapNodeContentsCommand::doCollateWith(UndoableCommand* command) {
   kdl::vec_sort(theirNodes);
 
   if (myNodes == theirNodes) {
+    // Our contents are stored relative to the contents the nodes had after this command was
+    // performed. The other command's contents are exactly those contents, stored relative to the
+    // current contents of the nodes, so we restore them and then store our contents relative to
+    // the current contents.
+    auto theirContents = std::unordered_map<Model::Node*, Model::NodeContentsDelta>{};
+    for (auto& [node, contents] : other->m_nodes) {
+      theirContents.emplace(node, std::move(contents));
+    }
+    other->m_nodes.clear();
+
+    for (auto& [node, contents] : m_nodes) {
+      const auto intermediateContents = std::move(theirContents.at(node)).apply(*node);
+      auto originalContents = std::move(contents).apply(intermediateContents);
+      contents = Model::NodeContentsDelta::create(*node, std::move(originalContents));
+    }
+
     m_updateLinkedGroupsHelper.collateWith(other->m_updateLinkedGroupsHelper);
     return true;
   }
 
   return false;
 }
+
+size_t SwapNodeContentsCommand::doGetMemoryUsage() const {
+  auto result = sizeof(*this) + name().capacity();
+  for (const auto& [node, contents] : m_nodes) {
+    result += sizeof(node) + contents.memoryUsage();
+  }
+  return result;
+}
+
+void SwapNodeContentsCommand::swapNodeContents(MapDocumentCommandFacade* document) {
+  auto nodes = std::vector<std::pair<Model::Node*, Model::NodeContents>>{};
+  nodes.reserve(m_nodes.size());
+  for (auto& [node, contents] : m_nodes) {
+    nodes.emplace_back(node, std::move(contents).apply(*node));
+  }
+  m_nodes.clear();
+
+  document->performSwapNodeContents(nodes);
+
+  for (auto& [node, contents] : nodes) {
+    m_nodes.emplace_back(node, Model::NodeContentsDelta::create(*node, std::move(contents)));
+  }
+}
 } // namespace View
 } // namespace TrenchBroom
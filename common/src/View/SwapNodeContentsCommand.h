@@ -21,6 +21,7 @@
 
 #include "Macros.h"
 #include "Model/NodeContents.h"
+#include "Model/NodeContentsDelta.h"
 #include "View/UndoableCommand.h"
 #include "View/UpdateLinkedGroupsHelper.h"
 
@@ -43,7 +44,11 @@ public:
   static const CommandType Type;
 
 protected:
-  std::vector<std::pair<Model::Node*, Model::NodeContents>> m_nodes;
+  /**
+   * The contents to swap into the nodes, stored relative to the current contents of the nodes to
+   * save memory on the undo stack.
+   */
+  std::vector<std::pair<Model::Node*, Model::NodeContentsDelta>> m_nodes;
   UpdateLinkedGroupsHelper m_updateLinkedGroupsHelper;
 
 public:
@@ -58,6 +63,11 @@ public:
 
   bool doCollateWith(UndoableCommand* command) override;
 
+  size_t doGetMemoryUsage() const override;
+
+private:
+  void swapNodeContents(MapDocumentCommandFacade* document);
+
   deleteCopyAndMove(SwapNodeContentsCommand);
 };
 } // namespace View
@@ -34,6 +34,7 @@ UndoableCommand::UndoableCommand(
 UndoableCommand::~UndoableCommand() {}
 
 std::unique_ptr<CommandResult> UndoableCommand::performDo(MapDocumentCommandFacade* document) {
+  m_memoryUsage = std::nullopt;
   auto result = Command::performDo(document);
   if (result->success() && m_modificationCount) {
     if (document) {
@@ -44,6 +45,7 @@ std::unique_ptr<CommandResult> UndoableCommand::performDo(MapDocumentCommandFaca
 }
 
 std::unique_ptr<CommandResult> UndoableCommand::performUndo(MapDocumentCommandFacade* document) {
+  m_memoryUsage = std::nullopt;
   m_state = CommandState::Undoing;
   auto result = doPerformUndo(document);
   if (result->success()) {
@@ -61,9 +63,21 @@ bool UndoableCommand::collateWith(UndoableCommand* command) {
   assert(command != this);
   if (command->type() == m_type && doCollateWith(command)) {
     m_modificationCount += command->m_modificationCount;
+    m_memoryUsage = std::nullopt;
     return true;
   }
   return false;
 }
+
+size_t UndoableCommand::memoryUsage() const {
+  if (!m_memoryUsage) {
+    m_memoryUsage = doGetMemoryUsage();
+  }
+  return *m_memoryUsage;
+}
+
+size_t UndoableCommand::doGetMemoryUsage() const {
+  return sizeof(*this) + name().capacity();
+}
 } // namespace View
 } // namespace TrenchBroom
@@ -22,7 +22,9 @@
 #include "Macros.h"
 #include "View/Command.h"
 
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
 
 namespace TrenchBroom {
@@ -32,6 +34,7 @@ class MapDocumentCommandFacade;
 class UndoableCommand : public Command {
 private:
   size_t m_modificationCount;
+  mutable std::optional<size_t> m_memoryUsage;
 
 protected:
   UndoableCommand(CommandType type, const std::string& name, bool updateModificationCount);
@@ -44,11 +47,24 @@ public:
 
   virtual bool collateWith(UndoableCommand* command);
 
+  /**
+   * Returns an estimate of the number of bytes this command holds on to while it is stored on the
+   * undo or redo stack. The estimate is cached until the command is executed, undone or collated
+   * with another command.
+   */
+  size_t memoryUsage() const;
+
 private:
   virtual std::unique_ptr<CommandResult> doPerformUndo(MapDocumentCommandFacade* document) = 0;
 
   virtual bool doCollateWith(UndoableCommand* command) = 0;
 
+  /**
+   * Commands that store node contents or detached nodes should override this to account for that
+   * memory. The default implementation only accounts for the command itself.
+   */
+  virtual size_t doGetMemoryUsage() const;
+
   deleteCopyAndMove(UndoableCommand);
 };
 } // namespace View
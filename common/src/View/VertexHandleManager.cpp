@@ -25,6 +25,7 @@
 #include "Preferences.h"
 #include "View/Grid.h"
 
+#include <vecmath/bbox.h>
 #include <vecmath/distance.h>
 #include <vecmath/intersection.h>
 #include <vecmath/plane.h>
@@ -35,19 +36,36 @@ namespace TrenchBroom {
 namespace View {
 VertexHandleManagerBase::~VertexHandleManagerBase() {}
 
+vm::bbox3 handleBounds(const vm::vec3& handle) {
+  return vm::bbox3(handle, handle);
+}
+
+vm::bbox3 handleBounds(const vm::segment3& handle) {
+  vm::bbox3::builder builder;
+  builder.add(handle.start());
+  builder.add(handle.end());
+  return builder.bounds();
+}
+
+vm::bbox3 handleBounds(const vm::polygon3& handle) {
+  vm::bbox3::builder builder;
+  builder.add(std::begin(handle), std::end(handle));
+  return builder.bounds();
+}
+
 const Model::HitType::Type VertexHandleManager::HandleHitType = Model::HitType::freeType();
 
 void VertexHandleManager::pick(
   const vm::ray3& pickRay, const Renderer::Camera& camera, Model::PickResult& pickResult) const {
-  for (const auto& [position, info] : m_handles) {
-    const auto distance = camera.pickPointHandle(
-      pickRay, position, static_cast<FloatType>(pref(Preferences::HandleRadius)));
+  const auto handleRadius = static_cast<FloatType>(pref(Preferences::HandleRadius));
+  forEachHandleNearRay(pickRay, camera, handleRadius, [&](const vm::vec3& position) {
+    const auto distance = camera.pickPointHandle(pickRay, position, handleRadius);
     if (!vm::is_nan(distance)) {
       const auto hitPoint = vm::point_at_distance(pickRay, distance);
       const auto error = vm::squared_distance(pickRay, position).distance;
       pickResult.addHit(Model::Hit(HandleHitType, distance, hitPoint, position, error));
     }
-  }
+  });
 }
 
 void VertexHandleManager::addHandles(const Model::BrushNode* brushNode) {
@@ -79,34 +97,33 @@ const Model::HitType::Type EdgeHandleManager::HandleHitType = Model::HitType::fr
 void EdgeHandleManager::pickGridHandle(
   const vm::ray3& pickRay, const Renderer::Camera& camera, const Grid& grid,
   Model::PickResult& pickResult) const {
-  for (const auto& [position, info] : m_handles) {
-    const FloatType edgeDist = camera.pickLineSegmentHandle(
-      pickRay, position, static_cast<FloatType>(pref(Preferences::HandleRadius)));
+  const auto handleRadius = static_cast<FloatType>(pref(Preferences::HandleRadius));
+  forEachHandleNearRay(pickRay, camera, handleRadius, [&](const vm::segment3& position) {
+    const FloatType edgeDist = camera.pickLineSegmentHandle(pickRay, position, handleRadius);
     if (!vm::is_nan(edgeDist)) {
       const vm::vec3 pointHandle = grid.snap(vm::point_at_distance(pickRay, edgeDist), position);
-      const FloatType pointDist = camera.pickPointHandle(
-        pickRay, pointHandle, static_cast<FloatType>(pref(Preferences::HandleRadius)));
+      const FloatType pointDist = camera.pickPointHandle(pickRay, pointHandle, handleRadius);
       if (!vm::is_nan(pointDist)) {
         const vm::vec3 hitPoint = vm::point_at_distance(pickRay, pointDist);
         pickResult.addHit(
           Model::Hit(HandleHitType, pointDist, hitPoint, HitType(position, pointHandle)));
       }
     }
-  }
+  });
 }
 
 void EdgeHandleManager::pickCenterHandle(
   const vm::ray3& pickRay, const Renderer::Camera& camera, Model::PickResult& pickResult) const {
-  for (const auto& [position, info] : m_handles) {
+  const auto handleRadius = static_cast<FloatType>(pref(Preferences::HandleRadius));
+  forEachHandleNearRay(pickRay, camera, handleRadius, [&](const vm::segment3& position) {
     const vm::vec3 pointHandle = position.center();
 
-    const FloatType pointDist = camera.pickPointHandle(
-      pickRay, pointHandle, static_cast<FloatType>(pref(Preferences::HandleRadius)));
+    const FloatType pointDist = camera.pickPointHandle(pickRay, pointHandle, handleRadius);
     if (!vm::is_nan(pointDist)) {
       const vm::vec3 hitPoint = vm::point_at_distance(pickRay, pointDist);
       pickResult.addHit(Model::Hit(HandleHitType, pointDist, hitPoint, position));
     }
-  }
+  });
 }
 
 void EdgeHandleManager::addHandles(const Model::BrushNode* brushNode) {
@@ -138,10 +155,11 @@ const Model::HitType::Type FaceHandleManager::HandleHitType = Model::HitType::fr
 void FaceHandleManager::pickGridHandle(
   const vm::ray3& pickRay, const Renderer::Camera& camera, const Grid& grid,
   Model::PickResult& pickResult) const {
-  for (const auto& [position, info] : m_handles) {
+  const auto handleRadius = static_cast<FloatType>(pref(Preferences::HandleRadius));
+  forEachHandleNearRay(pickRay, camera, handleRadius, [&](const vm::polygon3& position) {
     const auto [valid, plane] = vm::from_points(std::begin(position), std::end(position));
     if (!valid) {
-      continue;
+      return;
     }
 
     const auto distance =
@@ -149,29 +167,28 @@ void FaceHandleManager::pickGridHandle(
     if (!vm::is_nan(distance)) {
       const auto pointHandle = grid.snap(vm::point_at_distance(pickRay, distance), plane);
 
-      const auto pointDist = camera.pickPointHandle(
-        pickRay, pointHandle, static_cast<FloatType>(pref(Preferences::HandleRadius)));
+      const auto pointDist = camera.pickPointHandle(pickRay, pointHandle, handleRadius);
       if (!vm::is_nan(pointDist)) {
         const auto hitPoint = vm::point_at_distance(pickRay, pointDist);
         pickResult.addHit(
           Model::Hit(HandleHitType, pointDist, hitPoint, HitType(position, pointHandle)));
       }
     }
-  }
+  });
 }
 
 void FaceHandleManager::pickCenterHandle(
   const vm::ray3& pickRay, const Renderer::Camera& camera, Model::PickResult& pickResult) const {
-  for (const auto& [position, info] : m_handles) {
+  const auto handleRadius = static_cast<FloatType>(pref(Preferences::HandleRadius));
+  forEachHandleNearRay(pickRay, camera, handleRadius, [&](const vm::polygon3& position) {
     const auto pointHandle = position.center();
 
-    const auto pointDist = camera.pickPointHandle(
-      pickRay, pointHandle, static_cast<FloatType>(pref(Preferences::HandleRadius)));
+    const auto pointDist = camera.pickPointHandle(pickRay, pointHandle, handleRadius);
     if (!vm::is_nan(pointDist)) {
       const auto hitPoint = vm::point_at_distance(pickRay, pointDist);
       pickResult.addHit(Model::Hit(HandleHitType, pointDist, hitPoint, position));
     }
-  }
+  });
 }
 
 void FaceHandleManager::addHandles(const Model::BrushNode* brushNode) {
@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include "AABBTree.h"
 #include "FloatType.h"
 #include "Model/BrushFace.h"
 #include "Model/BrushNode.h"
@@ -28,8 +29,14 @@
 
 #include <kdl/vector_set.h>
 
+#include <vecmath/bbox.h>
+#include <vecmath/intersection.h>
+#include <vecmath/polygon.h>
+#include <vecmath/ray.h>
 #include <vecmath/segment.h>
 
+#include <algorithm>
+#include <cmath>
 #include <iterator>
 #include <map>
 #include <vector>
@@ -90,6 +97,13 @@ public:
   virtual void removeHandles(const Model::BrushNode* brushNode) = 0;
 };
 
+/**
+ * Returns the bounds of the given handle, which are used to index the handles spatially.
+ */
+vm::bbox3 handleBounds(const vm::vec3& handle);
+vm::bbox3 handleBounds(const vm::segment3& handle);
+vm::bbox3 handleBounds(const vm::polygon3& handle);
+
 template <typename H> class VertexHandleManagerBaseT : public VertexHandleManagerBase {
 public:
   using Handle = H;
@@ -160,6 +174,14 @@ protected:
    */
   HandleMap m_handles;
 
+  using HandleTree = AABBTree<FloatType, 3, const H*>;
+
+  /**
+   * Spatial index of the handles, which stores pointers to the keys of m_handles. These remain valid
+   * until the corresponding map entry is erased, at which point they are removed from the tree.
+   */
+  HandleTree m_handleTree;
+
   /**
    * The total number of selected handles, not counting duplicates.
    */
@@ -300,8 +322,13 @@ public:
    * @param handle the handle to add
    */
   void add(const Handle& handle) {
-    m_handles[handle].inc(); // unknown value gets value constructed, which for HandleInfo means its
-                             // default constructor is called
+    // unknown value gets value constructed, which for HandleInfo means its default constructor is
+    // called
+    const auto [it, inserted] = m_handles.try_emplace(handle);
+    if (inserted) {
+      m_handleTree.insert(handleBounds(handle), &it->first);
+    }
+    it->second.inc();
   }
 
   /**
@@ -319,6 +346,7 @@ public:
 
       if (info.count == 0) {
         deselect(info);
+        m_handleTree.remove(&it->first);
         m_handles.erase(it);
       }
       return true;
@@ -331,6 +359,7 @@ public:
    * Removes all handles from this manager.
    */
   void clear() {
+    m_handleTree.clear();
     m_handles.clear();
     m_selectedHandleCount = 0;
   }
@@ -423,9 +452,14 @@ public:
 private:
   template <typename F> void forEachCloseHandle(const H& otherHandle, F fun) {
     static const auto epsilon = 0.001 * 0.001;
-    for (auto& [handle, info] : m_handles) {
-      if (compare(otherHandle, handle, epsilon) == 0) {
-        fun(info);
+
+    auto candidates = std::vector<const H*>{};
+    m_handleTree.findIntersectors(
+      handleBounds(otherHandle).expand(epsilon), std::back_inserter(candidates));
+
+    for (const auto* candidate : candidates) {
+      if (compare(otherHandle, *candidate, epsilon) == 0) {
+        fun(m_handles.at(*candidate));
       }
     }
   }
@@ -473,6 +507,50 @@ public:
     }
   }
 
+protected:
+  /**
+   * Calls the given function for every handle that may be hit by the given picking ray, skipping
+   * handles that are too far away from the ray to be hit.
+   *
+   * A handle can only be hit if the ray intersects the handle bounds expanded by the handle's pick
+   * radius. The pick radius depends on the handle's distance from the camera, so the radius used
+   * for a box is the largest radius of any of its corners. The perspective scaling factor is an
+   * affine function of the position, so this is an upper bound of the radius of any point in the
+   * box.
+   *
+   * @tparam F the type of the function to call, which must accept a handle
+   * @param pickRay the picking ray
+   * @param camera the camera
+   * @param handleRadius the handle radius
+   * @param fun the function to call
+   */
+  template <typename F>
+  void forEachHandleNearRay(
+    const vm::ray3& pickRay, const Renderer::Camera& camera, const FloatType handleRadius,
+    F fun) const {
+    const auto mayHit = [&](const vm::bbox3& bounds) {
+      auto maxScaling = FloatType(0);
+      for (size_t i = 0; i < 8; ++i) {
+        const auto corner = vm::vec3(
+          (i & 1u) ? bounds.max.x() : bounds.min.x(), (i & 2u) ? bounds.max.y() : bounds.min.y(),
+          (i & 4u) ? bounds.max.z() : bounds.min.z());
+        const auto scaling = camera.perspectiveScalingFactor(vm::vec3f(corner));
+        maxScaling = std::max(maxScaling, static_cast<FloatType>(std::abs(scaling)));
+      }
+
+      const auto pickBounds = bounds.expand(FloatType(2) * handleRadius * maxScaling);
+      return pickBounds.contains(pickRay.origin) ||
+             !vm::is_nan(vm::intersect_ray_bbox(pickRay, pickBounds));
+    };
+
+    auto candidates = std::vector<const H*>{};
+    m_handleTree.findMatching(mayHit, std::back_inserter(candidates));
+
+    for (const auto* candidate : candidates) {
+      fun(*candidate);
+    }
+  }
+
 public:
   /**
    * Finds and returns all brushes in the given range which are incident to the given handle.
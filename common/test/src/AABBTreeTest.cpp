@@ -22,6 +22,7 @@
 #include <vecmath/ray.h>
 #include <vecmath/vec.h>
 
+#include <iterator>
 #include <set>
 #include <sstream>
 
@@ -567,6 +568,128 @@ TEST_CASE("AABBTreeTest.findIntersectorsFromInsideRootBBox", "[AABBTreeTest]") {
   assertIntersectors(tree, RAY(VEC(0.0, 0.0, 0.0), VEC::pos_x()), {2u});
 }
 
+TEST_CASE("AABBTreeTest.findIntersectorsOfBox", "[AABBTreeTest]") {
+  AABB tree;
+  tree.insert(BOX(VEC(-4.0, -1.0, -1.0), VEC(-2.0, +1.0, +1.0)), 1u);
+  tree.insert(BOX(VEC(+2.0, -1.0, -1.0), VEC(+4.0, +1.0, +1.0)), 2u);
+  tree.insert(BOX(VEC(-1.0, +2.0, -1.0), VEC(+1.0, +4.0, +1.0)), 3u);
+
+  const auto findIntersectors = [&](const BOX& bounds) {
+    const auto list = tree.findIntersectors(bounds);
+    return std::set<AABB::DataType>(std::begin(list), std::end(list));
+  };
+
+  CHECK(findIntersectors(BOX(VEC(-1.0, -1.0, -1.0), VEC(+1.0, +1.0, +1.0))).empty());
+  CHECK(
+    findIntersectors(BOX(VEC(-3.0, -1.0, -1.0), VEC(+1.0, +1.0, +1.0))) ==
+    std::set<AABB::DataType>{1u});
+  CHECK(
+    findIntersectors(BOX(VEC(-1.0, -1.0, -1.0), VEC(+3.0, +3.0, +1.0))) ==
+    std::set<AABB::DataType>{2u, 3u});
+  CHECK(
+    findIntersectors(BOX(VEC(-8.0, -8.0, -8.0), VEC(+8.0, +8.0, +8.0))) ==
+    std::set<AABB::DataType>{1u, 2u, 3u});
+}
+
+TEST_CASE("AABBTreeTest.findMatching", "[AABBTreeTest]") {
+  AABB tree;
+  tree.insert(BOX(VEC(-4.0, -1.0, -1.0), VEC(-2.0, +1.0, +1.0)), 1u);
+  tree.insert(BOX(VEC(+2.0, -1.0, -1.0), VEC(+4.0, +1.0, +1.0)), 2u);
+  tree.insert(BOX(VEC(-1.0, +2.0, -1.0), VEC(+1.0, +4.0, +1.0)), 3u);
+
+  const auto findMatching = [&](const auto& predicate) {
+    auto result = std::set<AABB::DataType>{};
+    tree.findMatching(predicate, std::inserter(result, std::end(result)));
+    return result;
+  };
+
+  CHECK(findMatching([](const BOX&) {
+          return false;
+        }).empty());
+  CHECK(
+    findMatching([](const BOX&) {
+      return true;
+    }) == std::set<AABB::DataType>{1u, 2u, 3u});
+  CHECK(
+    findMatching([](const BOX& bounds) {
+      return bounds.max.x() > 0.0;
+    }) == std::set<AABB::DataType>{2u, 3u});
+  CHECK(findMatching([](const BOX& bounds) {
+          return bounds.expand(1.0).contains(VEC(0.0, 0.0, 0.0));
+        }).empty());
+  CHECK(
+    findMatching([](const BOX& bounds) {
+      return bounds.expand(1.0).contains(VEC(0.0, 1.5, 0.0));
+    }) == std::set<AABB::DataType>{3u});
+}
+
+TEST_CASE("AABBTreeTest.updateAll", "[AABBTreeTest]") {
+  auto bounds = std::vector<BOX>{};
+  for (size_t i = 0u; i < 16u; ++i) {
+    const auto x = 4.0 * static_cast<double>(i);
+    bounds.emplace_back(VEC(x, 0.0, 0.0), VEC(x + 1.0, 1.0, 1.0));
+  }
+
+  AABB tree;
+  for (size_t i = 0u; i < bounds.size(); ++i) {
+    tree.insert(bounds[i], i);
+  }
+
+  const auto getBounds = [&](const size_t i) {
+    return bounds[i];
+  };
+
+  const auto assertTreeContainsAll = [&]() {
+    auto expectedBounds = bounds.front();
+    for (size_t i = 0u; i < bounds.size(); ++i) {
+      assertTreeContains(tree, bounds[i], i);
+      expectedBounds = vm::merge(expectedBounds, bounds[i]);
+    }
+    CHECK(tree.bounds() == expectedBounds);
+  };
+
+  SECTION("Refitting nodes that moved a little") {
+    const auto toUpdate = std::vector<size_t>{3u, 4u, 9u};
+    for (const auto i : toUpdate) {
+      bounds[i] = bounds[i].translate(VEC(0.5, 0.5, 0.0));
+    }
+
+    tree.updateAll(toUpdate, getBounds);
+    assertTreeContainsAll();
+  }
+
+  SECTION("Restructuring nodes that moved far") {
+    const auto toUpdate = std::vector<size_t>{2u, 7u};
+    bounds[2] = bounds[2].translate(VEC(100.0, 0.0, 0.0));
+    bounds[7] = bounds[7].translate(VEC(0.0, -200.0, 50.0));
+
+    tree.updateAll(toUpdate, getBounds);
+    assertTreeContainsAll();
+    CHECK(tree.findContainers(VEC(8.5, 0.5, 0.5)).empty());
+  }
+
+  SECTION("Rebuilding the tree when most nodes moved") {
+    auto toUpdate = std::vector<size_t>{};
+    for (size_t i = 0u; i < 12u; ++i) {
+      bounds[i] = bounds[i].translate(VEC(0.0, 0.0, 10.0 * static_cast<double>(i)));
+      toUpdate.push_back(i);
+    }
+
+    tree.updateAll(toUpdate, getBounds);
+    assertTreeContainsAll();
+    CHECK(tree.height() == 5u);
+  }
+
+  SECTION("Updating a node that is not in the tree") {
+    bounds[1] = bounds[1].translate(VEC(0.0, 0.0, 10.0));
+    bounds.emplace_back(VEC(0.0, 0.0, 0.0), VEC(1.0, 1.0, 1.0));
+
+    CHECK_THROWS_AS(tree.updateAll(std::vector<size_t>{1u, 16u}, getBounds), NodeTreeException);
+    CHECK(tree.findContainers(VEC(4.5, 0.5, 10.5)).empty());
+    CHECK(tree.findContainers(VEC(4.5, 0.5, 0.5)) == std::vector<size_t>{1u});
+  }
+}
+
 TEST_CASE("AABBTreeTest.clear", "[AABBTreeTest]") {
   const BOX bounds1(VEC(0.0, 0.0, 0.0), VEC(2.0, 1.0, 1.0));
   const BOX bounds2(VEC(-1.0, -1.0, -1.0), VEC(1.0, 1.0, 1.0));
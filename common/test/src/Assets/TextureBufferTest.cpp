@@ -0,0 +1,73 @@
+/*
+ Copyright (C) 2010-2017 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Assets/TextureBuffer.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "Catch2.h"
+
+namespace TrenchBroom {
+namespace Assets {
+static std::vector<unsigned char> toVector(const TextureBuffer& buffer) {
+  return std::vector<unsigned char>(buffer.data(), buffer.data() + buffer.size());
+}
+
+TEST_CASE("TextureBufferTest.generateMipmaps", "[TextureBufferTest]") {
+  SECTION("Square texture") {
+    auto buffers = TextureBufferList{};
+    setMipBufferSize(buffers, 3, 4, 4, GL_RGB);
+
+    // clang-format off
+    const auto level0 = std::vector<unsigned char>{
+      0,   0,   0,    4,   4,   4,    10,  20,  30,   10,  20,  30,
+      8,   8,   8,    12,  12,  12,   10,  20,  30,   10,  20,  30,
+      255, 0,   0,    255, 0,   0,    0,   0,   255,  0,   0,   255,
+      255, 0,   0,    255, 0,   0,    0,   0,   255,  0,   0,   255,
+    };
+    // clang-format on
+    std::copy(std::begin(level0), std::end(level0), buffers[0].data());
+
+    generateMipmaps(buffers, 1, 4, 4, GL_RGB);
+
+    CHECK(
+      toVector(buffers[1]) ==
+      std::vector<unsigned char>{6, 6, 6, 10, 20, 30, 255, 0, 0, 0, 0, 255});
+    CHECK(toVector(buffers[2]) == std::vector<unsigned char>{68, 7, 73});
+  }
+
+  SECTION("Non square texture with odd dimensions") {
+    auto buffers = TextureBufferList{};
+    setMipBufferSize(buffers, 2, 3, 1, GL_RGBA);
+
+    // clang-format off
+    const auto level0 = std::vector<unsigned char>{
+      10, 10, 10, 255,   20, 20, 20, 255,   40, 40, 40, 0,
+    };
+    // clang-format on
+    std::copy(std::begin(level0), std::end(level0), buffers[0].data());
+
+    generateMipmaps(buffers, 1, 3, 1, GL_RGBA);
+
+    CHECK(toVector(buffers[1]) == std::vector<unsigned char>{15, 15, 15, 255});
+  }
+}
+} // namespace Assets
+} // namespace TrenchBroom
@@ -153,6 +153,35 @@ TEST_CASE("DiskTest.openFile", "[DiskTest]") {
   CHECK_THROWS_AS(Disk::openFile(env.dir() + Path("does_not_exist.txt")), FileNotFoundException);
   CHECK(Disk::openFile(env.dir() + Path("test.txt")) != nullptr);
   CHECK(Disk::openFile(env.dir() + Path("anotherDir/subDirTest/test2.map")) != nullptr);
+
+  const auto file = Disk::openFile(env.dir() + Path("test.txt"));
+  CHECK(file->size() == 12u);
+  CHECK(file->reader().buffer().stringView() == "some content");
+}
+
+TEST_CASE("DiskTest.mappedFile", "[DiskTest]") {
+  auto env = makeTestEnvironment();
+  env.createFile(Path("empty.txt"), "");
+
+  CHECK_THROWS_AS(MappedFile(env.dir() + Path("does_not_exist.txt")), FileSystemException);
+
+  SECTION("Mapping a file") {
+    const auto file = std::make_shared<MappedFile>(env.dir() + Path("test.txt"));
+    CHECK(file->size() == 12u);
+    CHECK(file->reader().buffer().stringView() == "some content");
+
+    // views point into the mapping
+    const auto view = FileView(Path("view"), file, 5u, 7u);
+    auto reader = view.reader().buffer();
+    CHECK(reader.begin() == file->begin() + 5);
+    CHECK(reader.stringView() == "content");
+  }
+
+  SECTION("Mapping an empty file") {
+    const auto file = MappedFile(env.dir() + Path("empty.txt"));
+    CHECK(file.size() == 0u);
+    CHECK(file.reader().buffer().stringView().empty());
+  }
 }
 
 TEST_CASE("DiskTest.resolvePath", "[DiskTest]") {
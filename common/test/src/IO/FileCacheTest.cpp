@@ -0,0 +1,99 @@
+/*
+ Copyright (C) 2010-2017 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "IO/File.h"
+#include "IO/FileCache.h"
+#include "IO/Path.h"
+
+#include <memory>
+
+#include "Catch2.h"
+
+namespace TrenchBroom {
+namespace IO {
+static std::shared_ptr<File> makeFile(const size_t size) {
+  return std::make_shared<OwningBufferFile>(Path("file"), std::make_unique<char[]>(size), size);
+}
+
+TEST_CASE("FileCacheTest.getAndPut", "[FileCacheTest]") {
+  auto cache = FileCache{100u};
+  const auto owner1 = 1;
+  const auto owner2 = 2;
+
+  CHECK(cache.get(&owner1, 0u) == nullptr);
+
+  const auto file1 = makeFile(10u);
+  const auto file2 = makeFile(20u);
+  cache.put(&owner1, 0u, file1);
+  cache.put(&owner2, 0u, file2);
+
+  CHECK(cache.get(&owner1, 0u) == file1);
+  CHECK(cache.get(&owner2, 0u) == file2);
+  CHECK(cache.get(&owner1, 1u) == nullptr);
+  CHECK(cache.size() == 30u);
+
+  SECTION("Replacing a file") {
+    const auto file3 = makeFile(5u);
+    cache.put(&owner1, 0u, file3);
+    CHECK(cache.get(&owner1, 0u) == file3);
+    CHECK(cache.size() == 25u);
+  }
+
+  SECTION("Files larger than a quarter of the capacity are not cached") {
+    cache.put(&owner1, 1u, makeFile(26u));
+    CHECK(cache.get(&owner1, 1u) == nullptr);
+    CHECK(cache.size() == 30u);
+  }
+
+  SECTION("Evicting by owner") {
+    cache.put(&owner1, 1u, makeFile(10u));
+    cache.evict(&owner1);
+    CHECK(cache.get(&owner1, 0u) == nullptr);
+    CHECK(cache.get(&owner1, 1u) == nullptr);
+    CHECK(cache.get(&owner2, 0u) == file2);
+    CHECK(cache.size() == 20u);
+  }
+}
+
+TEST_CASE("FileCacheTest.evictLeastRecentlyUsed", "[FileCacheTest]") {
+  auto cache = FileCache{100u};
+  const auto owner = 1;
+
+  for (size_t i = 0; i < 4; ++i) {
+    cache.put(&owner, i, makeFile(25u));
+  }
+  CHECK(cache.size() == 100u);
+
+  // mark the first file as recently used
+  CHECK(cache.get(&owner, 0u) != nullptr);
+
+  cache.put(&owner, 4u, makeFile(25u));
+  CHECK(cache.size() == 100u);
+  CHECK(cache.get(&owner, 0u) != nullptr);
+  CHECK(cache.get(&owner, 1u) == nullptr);
+  CHECK(cache.get(&owner, 2u) != nullptr);
+
+  cache.setCapacity(60u);
+  CHECK(cache.size() == 50u);
+  CHECK(cache.get(&owner, 2u) != nullptr);
+  CHECK(cache.get(&owner, 4u) == nullptr);
+  CHECK(cache.get(&owner, 0u) != nullptr);
+}
+} // namespace IO
+} // namespace TrenchBroom
@@ -21,10 +21,16 @@
 #include "Exceptions.h"
 #include "IO/DiskFileSystem.h"
 #include "IO/DiskIO.h"
+#include "IO/File.h"
+#include "IO/FileCache.h"
 #include "IO/FileMatcher.h"
 
+#include <kdl/parallel.h>
+
 #include <algorithm>
 #include <cassert>
+#include <string>
+#include <vector>
 
 #include "Catch2.h"
 
@@ -51,6 +57,9 @@ TEST_CASE("ZipFileSystemTest.fileExists", "[ZipFileSystemTest]") {
 
   CHECK(fs.fileExists(Path("pics/tag1.pcx")));
   CHECK(fs.fileExists(Path("PICS/TAG1.pcX")));
+  CHECK(fs.fileExists(Path("textures/../Pics/./tag1.pcx")));
+  CHECK_FALSE(fs.fileExists(Path("pics")));
+  CHECK_FALSE(fs.fileExists(Path("pics/tag3.pcx")));
 }
 
 TEST_CASE("ZipFileSystemTest.findItems", "[ZipFileSystemTest]") {
@@ -142,5 +151,35 @@ TEST_CASE("ZipFileSystemTest.openFile", "[ZipFileSystemTest]") {
 
   CHECK(fs.openFile(Path("amnet.cfg")) != nullptr);
 }
+
+TEST_CASE("ZipFileSystemTest.openFileConcurrently", "[ZipFileSystemTest]") {
+  const Path zipPath = Disk::getCurrentWorkingDir() + Path("fixture/test/IO/Zip/zip_test.zip");
+
+  const ZipFileSystem fs(zipPath);
+  const auto paths = fs.findItemsRecursively(
+    Path(""), FileExtensionMatcher(std::vector<std::string>{"cfg", "pcx", "wal"}));
+  REQUIRE(paths.size() == 11u);
+
+  ZipFileSystem::inflatedFileCache().clear();
+
+  auto expected = std::vector<std::string>{};
+  for (const auto& path : paths) {
+    expected.push_back(std::string{fs.openFile(path)->reader().buffer().stringView()});
+  }
+
+  ZipFileSystem::inflatedFileCache().clear();
+
+  auto actual = std::vector<std::string>(paths.size());
+  kdl::parallel_for(paths.size() * 8u, [&](const size_t i) {
+    const auto index = i % paths.size();
+    auto contents = std::string{fs.openFile(paths[index])->reader().buffer().stringView()};
+    if (i < paths.size()) {
+      actual[index] = std::move(contents);
+    }
+  });
+
+  CHECK(actual == expected);
+  CHECK(ZipFileSystem::inflatedFileCache().size() > 0u);
+}
 } // namespace IO
 } // namespace TrenchBroom
@@ -0,0 +1,74 @@
+/*
+ Copyright (C) 2010-2017 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Model/BrushFaceAttributes.h"
+
+#include <vecmath/mat.h>
+#include <vecmath/mat_ext.h>
+#include <vecmath/mat_io.h>
+#include <vecmath/vec.h>
+
+#include <string>
+
+#include "Catch2.h"
+
+namespace TrenchBroom {
+namespace Model {
+TEST_CASE("BrushFaceAttributesTest.textureName", "[BrushFaceAttributesTest]") {
+  auto attributes = BrushFaceAttributes{"some_texture"};
+  CHECK(attributes.textureName() == "some_texture");
+
+  auto other = BrushFaceAttributes{std::string{"some_texture"}};
+  CHECK(&other.textureName() == &attributes.textureName());
+  CHECK(other == attributes);
+
+  CHECK_FALSE(attributes.setTextureName("some_texture"));
+  CHECK(attributes.setTextureName("other_texture"));
+  CHECK(attributes.textureName() == "other_texture");
+  CHECK(other != attributes);
+
+  const auto copy = BrushFaceAttributes{"other_texture", other};
+  CHECK(copy == attributes);
+}
+
+TEST_CASE("BrushFaceAttributesTest.bpMatrix", "[BrushFaceAttributesTest]") {
+  auto attributes = BrushFaceAttributes{"some_texture"};
+  CHECK_FALSE(attributes.hasBrushPrimitMode());
+  CHECK(attributes.bpMatrix() == vm::mat4x4f::identity());
+
+  CHECK_FALSE(attributes.setBrushPrimitMatrix(vm::mat4x4f::identity()));
+  CHECK_FALSE(attributes.hasBrushPrimitMode());
+
+  const auto matrix = vm::translation_matrix(vm::vec3f{1.0f, 2.0f, 0.0f});
+  CHECK(attributes.setBrushPrimitMatrix(matrix));
+  CHECK(attributes.hasBrushPrimitMode());
+  CHECK(attributes.bpMatrix() == matrix);
+
+  const auto copy = attributes;
+  CHECK(copy.bpMatrix() == matrix);
+  CHECK(copy == attributes);
+
+  CHECK(attributes.setBrushPrimitMatrix(vm::mat4x4f::identity()));
+  CHECK(attributes.hasBrushPrimitMode());
+  CHECK(attributes.bpMatrix() == vm::mat4x4f::identity());
+  CHECK(copy.bpMatrix() == matrix);
+  CHECK(copy != attributes);
+}
+} // namespace Model
+} // namespace TrenchBroom
@@ -22,16 +22,22 @@
 #include "Exceptions.h"
 #include "FloatType.h"
 #include "IO/DiskIO.h"
+#include "IO/FileMatcher.h"
 #include "IO/IOUtils.h"
 #include "IO/NodeReader.h"
+#include "IO/Path.h"
 #include "IO/TestParserStatus.h"
+#include "IO/WorldReader.h"
 #include "Model/BrushBuilder.h"
 #include "Model/BrushError.h"
 #include "Model/BrushFace.h"
 #include "Model/BrushGeometry.h"
 #include "Model/BrushNode.h"
 #include "Model/Entity.h"
+#include "Model/MapFormat.h"
+#include "Model/ModelUtils.h"
 #include "Model/Polyhedron.h"
+#include "Model/WorldNode.h"
 
 #include <kdl/intrusive_circular_list.h>
 #include <kdl/result.h>
@@ -46,7 +52,9 @@
 #include <vecmath/vec_ext.h>
 
 #include <fstream>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Catch2.h"
@@ -116,6 +124,106 @@ TEST_CASE("BrushTest.constructBrushWithRedundantFaces", "[BrushTest]") {
       .is_error());
 }
 
+/**
+ * Builds the geometry for the given brush's face planes both by intersecting the planes and by
+ * clipping, just like Brush::updateGeometryFromFaces does, and checks that both yield the same
+ * vertices and link the same planes to the same faces. Returns false if the geometry cannot be
+ * built by intersecting the planes, in which case Brush falls back to clipping anyway.
+ */
+static bool checkGeometryFromPlanesMatchesClipping(
+  const Brush& brush, const vm::bbox3& worldBounds) {
+  const auto planes = kdl::vec_transform(brush.faces(), [](const BrushFace& face) {
+    return face.boundary();
+  });
+
+  auto faceGeometries = std::vector<BrushFaceGeometry*>{};
+  auto fromPlanes = BrushGeometry::fromPlanes(planes, worldBounds, faceGeometries);
+  if (!fromPlanes) {
+    return false;
+  }
+
+  REQUIRE(faceGeometries.size() == planes.size());
+  for (size_t i = 0u; i < planes.size(); ++i) {
+    if (faceGeometries[i] != nullptr) {
+      faceGeometries[i]->setPayload(i);
+    }
+  }
+
+  auto clipped = BrushGeometry{worldBounds};
+  for (size_t i = 0u; i < planes.size(); ++i) {
+    const auto result = clipped.clip(planes[i]);
+    REQUIRE_FALSE(result.empty());
+    if (result.success()) {
+      result.face()->setPayload(i);
+    }
+  }
+
+  fromPlanes->correctVertexPositions();
+  REQUIRE(fromPlanes->healEdges());
+  clipped.correctVertexPositions();
+  REQUIRE(clipped.healEdges());
+
+  CHECK(fromPlanes->vertexCount() == clipped.vertexCount());
+  CHECK(fromPlanes->edgeCount() == clipped.edgeCount());
+  CHECK(fromPlanes->faceCount() == clipped.faceCount());
+  for (const auto* vertex : fromPlanes->vertices()) {
+    CHECK(clipped.hasVertex(vertex->position(), vm::C::almost_zero()));
+  }
+
+  auto clippedFaces = std::unordered_map<size_t, const BrushFaceGeometry*>{};
+  for (const auto* face : clipped.faces()) {
+    REQUIRE(face->payload());
+    clippedFaces[*face->payload()] = face;
+  }
+
+  for (const auto* face : fromPlanes->faces()) {
+    REQUIRE(face->payload());
+
+    const auto it = clippedFaces.find(*face->payload());
+    REQUIRE(it != clippedFaces.end());
+    CHECK(face->hasVertexPositions(it->second->vertexPositions(), vm::C::almost_zero()));
+  }
+
+  return true;
+}
+
+TEST_CASE("BrushTest.buildGeometryFromPlanesMatchesClipping", "[BrushTest]") {
+  const auto worldBounds = vm::bbox3{8192.0};
+  const auto mapFormats = std::vector<MapFormat>{
+    MapFormat::Standard,     MapFormat::Valve,         MapFormat::Quake2,
+    MapFormat::Quake2_Valve, MapFormat::Quake3_Legacy, MapFormat::Quake3_Valve,
+    MapFormat::Quake3,       MapFormat::Hexen2,        MapFormat::Daikatana,
+  };
+
+  const auto mapPaths = IO::Disk::findItemsRecursively(
+    IO::Disk::getCurrentWorkingDir() + IO::Path("fixture/test"), IO::FileExtensionMatcher("map"));
+  REQUIRE_FALSE(mapPaths.empty());
+
+  auto checkedBrushCount = size_t(0);
+  for (const auto& mapPath : mapPaths) {
+    CAPTURE(mapPath.asString());
+
+    const auto data = IO::Disk::readTextFile(mapPath);
+    auto status = IO::TestParserStatus{};
+
+    auto world = std::unique_ptr<WorldNode>{};
+    try {
+      world = IO::WorldReader::tryRead(data, mapFormats, worldBounds, {}, status);
+    } catch (const IO::WorldReaderException&) {
+      // some fixtures are deliberately broken
+      continue;
+    }
+
+    for (const auto* brushNode : filterBrushNodes(collectDescendants({world.get()}))) {
+      if (checkGeometryFromPlanesMatchesClipping(brushNode->brush(), worldBounds)) {
+        ++checkedBrushCount;
+      }
+    }
+  }
+
+  CHECK(checkedBrushCount > 0u);
+}
+
 TEST_CASE("BrushTest.clip", "[BrushTest]") {
   const vm::bbox3 worldBounds(4096.0);
 
@@ -149,6 +257,101 @@ TEST_CASE("BrushTest.clip", "[BrushTest]") {
   CHECK_FALSE(brush.findFace(right.boundary()));
 }
 
+TEST_CASE("BrushTest.copySharesGeometry", "[BrushTest]") {
+  const vm::bbox3 worldBounds(4096.0);
+
+  BrushBuilder builder(MapFormat::Standard, worldBounds);
+  const Brush original = builder.createCube(64.0, "texture").value();
+
+  Brush copy = original;
+  REQUIRE(copy.faceCount() == original.faceCount());
+  for (size_t i = 0u; i < copy.faceCount(); ++i) {
+    REQUIRE(copy.face(i).geometry() != nullptr);
+    CHECK(copy.face(i).geometry() == original.face(i).geometry());
+    CHECK(copy.face(i).vertexPositions() == original.face(i).vertexPositions());
+  }
+
+  // changing the copy's geometry must not affect the original
+  BrushFace clip =
+    createParaxial(vm::vec3(8.0, 0.0, 0.0), vm::vec3(8.0, 0.0, 1.0), vm::vec3(8.0, 1.0, 0.0));
+  REQUIRE(copy.clip(worldBounds, clip).is_success());
+
+  CHECK(copy.bounds() == vm::bbox3(vm::vec3(-32.0, -32.0, -32.0), vm::vec3(8.0, 32.0, 32.0)));
+  CHECK(original.bounds() == vm::bbox3(32.0));
+  CHECK(original.vertexCount() == 8u);
+  for (size_t i = 0u; i < original.faceCount(); ++i) {
+    const auto& face = original.face(i);
+    CHECK(face.geometry()->payload() == i);
+    CHECK(original.hasFace(vm::polygon3(face.vertexPositions())));
+  }
+}
+
+TEST_CASE("BrushTest.hasNonIntegerVertices", "[BrushTest]") {
+  const vm::bbox3 worldBounds(4096.0);
+
+  BrushBuilder builder(MapFormat::Standard, worldBounds);
+  Brush brush = builder.createCube(64.0, "texture").value();
+  CHECK_FALSE(brush.hasNonIntegerVertices());
+
+  REQUIRE(
+    brush.moveVertices(worldBounds, {vm::vec3(32.0, 32.0, 32.0)}, vm::vec3(-0.5, 0.0, 0.0))
+      .is_success());
+  CHECK(brush.hasNonIntegerVertices());
+
+  const Brush copy = brush;
+  CHECK(copy.hasNonIntegerVertices());
+
+  REQUIRE(brush.snapVertices(worldBounds, 1.0).is_success());
+  CHECK_FALSE(brush.hasNonIntegerVertices());
+  CHECK(copy.hasNonIntegerVertices());
+}
+
+TEST_CASE("BrushTest.snapVerticesOnGrid", "[BrushTest]") {
+  const vm::bbox3 worldBounds(4096.0);
+
+  BrushBuilder builder(MapFormat::Standard, worldBounds);
+  const Brush original = builder.createCube(64.0, "texture").value();
+
+  Brush brush = original;
+  CHECK(brush.canSnapVertices(worldBounds, 16.0));
+  REQUIRE(brush.snapVertices(worldBounds, 16.0).is_success());
+  CHECK(brush == original);
+
+  REQUIRE(
+    brush.moveVertices(worldBounds, {vm::vec3(32.0, 32.0, 32.0)}, vm::vec3(-0.5, 0.0, 0.0))
+      .is_success());
+  CHECK(brush.canSnapVertices(worldBounds, 16.0));
+  REQUIRE(brush.snapVertices(worldBounds, 16.0).is_success());
+  CHECK(brush.hasVertex(vm::vec3(32.0, 32.0, 32.0)));
+  CHECK_FALSE(brush.hasVertex(vm::vec3(31.5, 32.0, 32.0)));
+}
+
+TEST_CASE("BrushTest.hasVertexEdgeFaceOutsideOfBounds", "[BrushTest]") {
+  const vm::bbox3 worldBounds(4096.0);
+
+  BrushBuilder builder(MapFormat::Standard, worldBounds);
+  const Brush brush = builder.createCube(64.0, "texture").value();
+
+  const auto offset = vm::vec3(0.5, 0.0, 0.0);
+
+  const auto vertex = vm::vec3(32.0, 32.0, 32.0);
+  CHECK(brush.hasVertex(vertex));
+  CHECK_FALSE(brush.hasVertex(vertex + offset));
+  CHECK(brush.hasVertex(vertex + offset, 1.0));
+
+  const auto* edge = brush.edges().front();
+  const auto edgePosition =
+    vm::segment3(edge->firstVertex()->position(), edge->secondVertex()->position());
+  CHECK(brush.hasEdge(edgePosition));
+  CHECK_FALSE(brush.hasEdge(edgePosition.translate(offset)));
+  CHECK(brush.hasEdge(edgePosition.translate(offset), 1.0));
+
+  const auto facePosition = vm::polygon3(brush.face(0).vertexPositions());
+  CHECK(brush.hasFace(facePosition));
+  CHECK_FALSE(brush.hasFace(facePosition.translate(offset)));
+  CHECK(brush.hasFace(facePosition.translate(offset), 1.0));
+}
+
 TEST_CASE("BrushTest.moveBoundary", "[BrushTest]") {
   const vm::bbox3 worldBounds(4096.0);
   Brush brush =
@@ -302,6 +505,38 @@ TEST_CASE("BrushTest.moveVertex", "[BrushTest]") {
   assertTexture("bottom", brush, p1, p3, p7, p5);
 }
 
+TEST_CASE("BrushTest.moveVertexWithValidatedResult", "[BrushTest]") {
+  const vm::bbox3 worldBounds(4096.0);
+
+  BrushBuilder builder(MapFormat::Standard, worldBounds);
+  const Brush cube = builder.createCube(64.0, "texture").value();
+
+  const vm::vec3 p8(+32.0, +32.0, +32.0);
+  const vm::vec3 p9(+16.0, +16.0, +32.0);
+  const auto vertexPositions = std::vector<vm::vec3>({p8});
+
+  SECTION("Valid move") {
+    Brush expected = cube;
+    REQUIRE(expected.moveVertices(worldBounds, vertexPositions, p9 - p8).is_success());
+
+    Brush brush = cube;
+    const auto canMoveResult = brush.validateMoveVertices(worldBounds, vertexPositions, p9 - p8);
+    REQUIRE(canMoveResult.success);
+    CHECK(brush.moveVertices(worldBounds, vertexPositions, p9 - p8, canMoveResult).is_success());
+    CHECK(brush.hasVertex(p9));
+    CHECK(brush == expected);
+  }
+
+  SECTION("Invalid move") {
+    Brush brush = cube;
+    const auto delta = vm::vec3(4096.0, 0.0, 0.0);
+    const auto canMoveResult = brush.validateMoveVertices(worldBounds, vertexPositions, delta);
+    REQUIRE_FALSE(canMoveResult.success);
+    CHECK(brush.moveVertices(worldBounds, vertexPositions, delta, canMoveResult).is_error());
+    CHECK(brush == cube);
+  }
+}
+
 TEST_CASE("BrushTest.moveTetrahedronVertexToOpposideSide", "[BrushTest]") {
   const vm::bbox3 worldBounds(4096.0);
 
@@ -2235,5 +2470,35 @@ TEST_CASE("BrushTest.subtractEnclosed", "[BrushTest]") {
     brush1.subtract(MapFormat::Standard, worldBounds, "texture", brush2), [](const auto&) {});
   CHECK(result.size() == 0u);
 }
+
+TEST_CASE("BrushTest.subtractIgnoresDisjointSubtrahends", "[BrushTest]") {
+  const vm::bbox3 worldBounds(4096.0);
+
+  BrushBuilder builder(MapFormat::Standard, worldBounds);
+  const Brush minuend =
+    builder.createCuboid(vm::bbox3(vm::vec3::fill(-32.0), vm::vec3::fill(+32.0)), "texture")
+      .value();
+  const Brush touching =
+    builder
+      .createCuboid(vm::bbox3(vm::vec3(16.0, -64.0, -64.0), vm::vec3(64.0, 64.0, 64.0)), "texture")
+      .value();
+  const Brush disjoint =
+    builder.createCuboid(vm::bbox3(vm::vec3::fill(128.0), vm::vec3::fill(192.0)), "texture")
+      .value();
+
+  const auto onlyTouching = kdl::collect_values(
+    minuend.subtract(MapFormat::Standard, worldBounds, "texture", touching), [](const auto&) {});
+  const auto both = kdl::collect_values(
+    minuend.subtract(
+      MapFormat::Standard, worldBounds, "texture", std::vector<const Brush*>{&disjoint, &touching}),
+    [](const auto&) {});
+
+  REQUIRE(onlyTouching.size() == 1u);
+  REQUIRE(both.size() == 1u);
+  CHECK(both.front().bounds() == onlyTouching.front().bounds());
+  CHECK(
+    both.front().bounds() ==
+    vm::bbox3(vm::vec3(-32.0, -32.0, -32.0), vm::vec3(16.0, 32.0, 32.0)));
+}
 } // namespace Model
 } // namespace TrenchBroom
@@ -260,6 +260,35 @@ TEST_CASE("EntityTest.hasProperty") {
 
   entity.setProperties({}, {{"key", "value"}});
   CHECK(entity.hasProperty("key"));
+  CHECK(!entity.hasProperty("EntityTest.hasProperty: a key that was never used"));
+}
+
+TEST_CASE("EntityTest.propertyKeysAreInterned") {
+  const auto property1 = EntityProperty{"some_key", "value1"};
+  auto property2 = EntityProperty{"some_other_key", "value2"};
+  CHECK(&property1.key() != &property2.key());
+
+  property2.setKey(std::string{"some_"} + "key");
+  CHECK(&property1.key() == &property2.key());
+
+  Entity entity;
+  entity.setProperties({}, {property2});
+  CHECK(entity.hasProperty(std::string{"some_"} + "key"));
+  CHECK(entity.property("some_key") == &entity.properties().front().value());
+  CHECK(&entity.properties().front().key() == &property1.key());
+  CHECK(!entity.hasProperty("EntityTest.propertyKeysAreInterned: unused key"));
+}
+
+TEST_CASE("EntityTest.propertyKeyMatcher") {
+  const auto classname = EntityProperty{EntityPropertyKeys::Classname, "light"};
+  const auto light = EntityProperty{"light", "300"};
+
+  // well-known keys are compared by address, other keys by value
+  CHECK(EntityPropertyKeyMatcher{EntityPropertyKeys::Classname}(classname));
+  CHECK_FALSE(EntityPropertyKeyMatcher{EntityPropertyKeys::Classname}(light));
+  CHECK(EntityPropertyKeyMatcher{std::string{"class"} + "name"}(classname));
+  CHECK(EntityPropertyKeyMatcher{std::string{"light"}}(light));
+  CHECK_FALSE(EntityPropertyKeyMatcher{std::string{"light"}}(classname));
 }
 
 TEST_CASE("EntityTest.originUpdateWithSetProperties") {
@@ -0,0 +1,130 @@
+/*
+ Copyright (C) 2010-2017 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Model/NodeContentsDelta.h"
+#include "Model/Brush.h"
+#include "Model/BrushBuilder.h"
+#include "Model/BrushFace.h"
+#include "Model/BrushNode.h"
+#include "Model/Entity.h"
+#include "Model/EntityNode.h"
+#include "Model/MapFormat.h"
+#include "Model/NodeContents.h"
+
+#include <kdl/result.h>
+
+#include <vecmath/bbox.h>
+#include <vecmath/mat.h>
+#include <vecmath/mat_ext.h>
+#include <vecmath/vec.h>
+
+#include "Catch2.h"
+
+namespace TrenchBroom {
+namespace Model {
+TEST_CASE("NodeContentsDeltaTest.brushWithChangedFaceAttributes", "[NodeContentsDeltaTest]") {
+  const auto worldBounds = vm::bbox3{8192.0};
+  const auto builder = BrushBuilder{MapFormat::Standard, worldBounds};
+
+  auto brushNode = BrushNode{builder.createCube(64.0, "texture").value()};
+
+  auto modifiedBrush = brushNode.brush();
+  modifiedBrush.face(0).setAttributes(BrushFaceAttributes{"other"});
+
+  auto delta = NodeContentsDelta::create(brushNode, NodeContents{modifiedBrush});
+  CHECK(delta.isDelta());
+
+  const auto restored = std::move(delta).apply(brushNode);
+  const auto& restoredBrush = std::get<Brush>(restored.get());
+  CHECK(restoredBrush == modifiedBrush);
+
+  // every restored face must be linked to the shared geometry
+  REQUIRE(restoredBrush.faceCount() == brushNode.brush().faceCount());
+  for (size_t i = 0u; i < restoredBrush.faceCount(); ++i) {
+    const auto& face = restoredBrush.face(i);
+    REQUIRE(face.geometry() != nullptr);
+    CHECK(face.geometry() == brushNode.brush().face(i).geometry());
+    CHECK(face.vertexPositions() == brushNode.brush().face(i).vertexPositions());
+  }
+  CHECK(restoredBrush.vertexPositions() == brushNode.brush().vertexPositions());
+  CHECK(restoredBrush.face(0).attributes().textureName() == "other");
+}
+
+TEST_CASE("NodeContentsDeltaTest.brushWithChangedGeometry", "[NodeContentsDeltaTest]") {
+  const auto worldBounds = vm::bbox3{8192.0};
+  const auto builder = BrushBuilder{MapFormat::Standard, worldBounds};
+
+  auto brushNode = BrushNode{builder.createCube(64.0, "texture").value()};
+
+  auto modifiedBrush = brushNode.brush();
+  REQUIRE(modifiedBrush
+            .transform(worldBounds, vm::translation_matrix(vm::vec3{16.0, 0.0, 0.0}), false)
+            .is_success());
+
+  auto delta = NodeContentsDelta::create(brushNode, NodeContents{modifiedBrush});
+  CHECK_FALSE(delta.isDelta());
+
+  const auto restored = std::move(delta).apply(brushNode);
+  CHECK(std::get<Brush>(restored.get()) == modifiedBrush);
+}
+
+TEST_CASE("NodeContentsDeltaTest.relativeToContents", "[NodeContentsDeltaTest]") {
+  const auto worldBounds = vm::bbox3{8192.0};
+  const auto builder = BrushBuilder{MapFormat::Standard, worldBounds};
+
+  const auto base = NodeContents{builder.createCube(64.0, "texture").value()};
+
+  auto modifiedBrush = std::get<Brush>(base.get());
+  modifiedBrush.face(1).setAttributes(BrushFaceAttributes{"other"});
+
+  auto delta = NodeContentsDelta::create(base, NodeContents{modifiedBrush});
+  CHECK(delta.isDelta());
+
+  const auto restored = std::move(delta).apply(base);
+  CHECK(std::get<Brush>(restored.get()) == modifiedBrush);
+}
+
+TEST_CASE("NodeContentsDeltaTest.memoryUsageOfSharedGeometry", "[NodeContentsDeltaTest]") {
+  const auto worldBounds = vm::bbox3{8192.0};
+  const auto builder = BrushBuilder{MapFormat::Standard, worldBounds};
+
+  const auto brush = builder.createCube(64.0, "texture").value();
+  const auto unsharedUsage = memoryUsage(brush);
+
+  // the shared geometry is split between both brushes
+  const auto copy = brush;
+  CHECK(memoryUsage(brush) < unsharedUsage);
+  CHECK(memoryUsage(copy) == memoryUsage(brush));
+  CHECK(memoryUsage(brush) + memoryUsage(copy) < 2u * unsharedUsage);
+}
+
+TEST_CASE("NodeContentsDeltaTest.entity", "[NodeContentsDeltaTest]") {
+  auto entityNode = EntityNode{Entity{}};
+
+  auto modifiedEntity = entityNode.entity();
+  modifiedEntity.addOrUpdateProperty({}, "this", "that");
+
+  auto delta = NodeContentsDelta::create(entityNode, NodeContents{modifiedEntity});
+  CHECK_FALSE(delta.isDelta());
+
+  const auto restored = std::move(delta).apply(entityNode);
+  CHECK(std::get<Entity>(restored.get()) == modifiedEntity);
+}
+} // namespace Model
+} // namespace TrenchBroom
@@ -449,6 +449,31 @@ TEST_CASE("PolyhedronTest.copy", "[PolyhedronTest]") {
   CHECK(Polyhedron3d({p1, p2, p3, p4}) == (Polyhedron3d() = Polyhedron3d({p1, p2, p3, p4})));
 }
 
+TEST_CASE("PolyhedronTest.extendedBy", "[PolyhedronTest]") {
+  const vm::vec3d p1(-8.0, -8.0, -8.0);
+  const vm::vec3d p2(-8.0, -8.0, +8.0);
+  const vm::vec3d p3(-8.0, +8.0, -8.0);
+  const vm::vec3d p4(-8.0, +8.0, +8.0);
+  const vm::vec3d p5(+8.0, -8.0, -8.0);
+  const vm::vec3d p6(+8.0, -8.0, +8.0);
+  const vm::vec3d p7(+8.0, +8.0, -8.0);
+  const vm::vec3d p8(+8.0, +8.0, +8.0);
+  const vm::vec3d p9(+16.0, +16.0, +16.0);
+  const vm::vec3d p10(+2.0, +2.0, +2.0);
+
+  CHECK(Polyhedron3d().extendedBy({}) == Polyhedron3d());
+  CHECK(Polyhedron3d().extendedBy({p1, p2, p3}) == Polyhedron3d({p1, p2, p3}));
+  CHECK(Polyhedron3d({p1}).extendedBy({p2, p3, p4}) == Polyhedron3d({p1, p2, p3, p4}));
+
+  const auto remaining = Polyhedron3d({p1, p2, p3, p4, p5, p6, p7});
+  CHECK(remaining.extendedBy({p8}) == Polyhedron3d({p1, p2, p3, p4, p5, p6, p7, p8}));
+  CHECK(remaining.extendedBy({p9}) == Polyhedron3d({p1, p2, p3, p4, p5, p6, p7, p9}));
+  CHECK(remaining.extendedBy({p10}) == remaining);
+
+  // the original polyhedron is not modified
+  CHECK(remaining == Polyhedron3d({p1, p2, p3, p4, p5, p6, p7}));
+}
+
 TEST_CASE("PolyhedronTest.swap", "[PolyhedronTest]") {
   const vm::vec3d p1(0.0, 0.0, 8.0);
   const vm::vec3d p2(8.0, 0.0, 0.0);
@@ -475,6 +500,108 @@ TEST_CASE("PolyhedronTest.swap", "[PolyhedronTest]") {
   CHECK(rhs.bounds() == original.bounds());
 }
 
+static void checkFromPlanesMatchesClipping(const std::vector<vm::plane3d>& planes) {
+  const auto bounds = vm::bbox3d{8192.0};
+
+  auto faces = std::vector<PFace*>{};
+  const auto fromPlanes = Polyhedron3d::fromPlanes(planes, bounds, faces);
+  REQUIRE(fromPlanes);
+  REQUIRE(faces.size() == planes.size());
+
+  auto clipped = Polyhedron3d{bounds};
+  for (const auto& plane : planes) {
+    REQUIRE_FALSE(clipped.clip(plane).empty());
+  }
+
+  CHECK(fromPlanes->vertexCount() == clipped.vertexCount());
+  CHECK(fromPlanes->edgeCount() == clipped.edgeCount());
+  CHECK(fromPlanes->faceCount() == clipped.faceCount());
+  CHECK(fromPlanes->bounds() == clipped.bounds());
+
+  for (const auto* vertex : fromPlanes->vertices()) {
+    CHECK(clipped.hasVertex(vertex->position(), vm::constants<double>::almost_zero()));
+  }
+  for (const auto* face : fromPlanes->faces()) {
+    CHECK(clipped.hasFace(face->vertexPositions(), vm::constants<double>::almost_zero()));
+  }
+  for (size_t i = 0u; i < planes.size(); ++i) {
+    if (faces[i] != nullptr) {
+      CHECK(faces[i]->plane() == planes[i]);
+    }
+  }
+}
+
+TEST_CASE("PolyhedronTest.fromPlanes", "[PolyhedronTest]") {
+  const auto cube = std::vector<vm::plane3d>{
+    vm::plane3d{vm::vec3d{-32.0, 0.0, 0.0}, vm::vec3d::neg_x()},
+    vm::plane3d{vm::vec3d{+32.0, 0.0, 0.0}, vm::vec3d::pos_x()},
+    vm::plane3d{vm::vec3d{0.0, -32.0, 0.0}, vm::vec3d::neg_y()},
+    vm::plane3d{vm::vec3d{0.0, +32.0, 0.0}, vm::vec3d::pos_y()},
+    vm::plane3d{vm::vec3d{0.0, 0.0, -32.0}, vm::vec3d::neg_z()},
+    vm::plane3d{vm::vec3d{0.0, 0.0, +32.0}, vm::vec3d::pos_z()},
+  };
+
+  SECTION("Cube") {
+    checkFromPlanesMatchesClipping(cube);
+
+    auto faces = std::vector<PFace*>{};
+    const auto p = Polyhedron3d::fromPlanes(cube, vm::bbox3d{8192.0}, faces);
+    REQUIRE(p);
+    CHECK(*p == Polyhedron3d{vm::bbox3d{32.0}});
+  }
+
+  SECTION("Cube with a slanted face") {
+    auto planes = cube;
+    planes.push_back(
+      vm::plane3d{vm::vec3d{8.0, 0.0, 8.0}, vm::normalize(vm::vec3d{1.0, 0.0, 1.0})});
+    checkFromPlanesMatchesClipping(planes);
+  }
+
+  SECTION("Cube with a redundant plane") {
+    auto planes = cube;
+    planes.push_back(vm::plane3d{vm::vec3d{0.0, 0.0, 64.0}, vm::vec3d::pos_z()});
+    checkFromPlanesMatchesClipping(planes);
+
+    auto faces = std::vector<PFace*>{};
+    REQUIRE(Polyhedron3d::fromPlanes(planes, vm::bbox3d{8192.0}, faces));
+    CHECK(faces.back() == nullptr);
+  }
+
+  SECTION("Falls back for a pyramid") {
+    // the apex lies on four planes
+    const auto planes = std::vector<vm::plane3d>{
+      vm::plane3d{vm::vec3d{0.0, 0.0, 0.0}, vm::vec3d::neg_z()},
+      vm::plane3d{vm::vec3d{0.0, 0.0, 32.0}, vm::normalize(vm::vec3d{-1.0, 0.0, 1.0})},
+      vm::plane3d{vm::vec3d{0.0, 0.0, 32.0}, vm::normalize(vm::vec3d{+1.0, 0.0, 1.0})},
+      vm::plane3d{vm::vec3d{0.0, 0.0, 32.0}, vm::normalize(vm::vec3d{0.0, -1.0, 1.0})},
+      vm::plane3d{vm::vec3d{0.0, 0.0, 32.0}, vm::normalize(vm::vec3d{0.0, +1.0, 1.0})},
+    };
+
+    auto faces = std::vector<PFace*>{};
+    CHECK_FALSE(Polyhedron3d::fromPlanes(planes, vm::bbox3d{8192.0}, faces));
+  }
+
+  SECTION("Falls back if the planes are not closed") {
+    const auto planes = std::vector<vm::plane3d>{cube.begin(), std::next(cube.begin(), 5)};
+
+    auto faces = std::vector<PFace*>{};
+    CHECK_FALSE(Polyhedron3d::fromPlanes(planes, vm::bbox3d{8192.0}, faces));
+  }
+
+  SECTION("Falls back if the result exceeds the bounds") {
+    auto faces = std::vector<PFace*>{};
+    CHECK_FALSE(Polyhedron3d::fromPlanes(cube, vm::bbox3d{16.0}, faces));
+  }
+
+  SECTION("Falls back if the result is empty") {
+    auto planes = cube;
+    planes.push_back(vm::plane3d{vm::vec3d{-64.0, 0.0, 0.0}, vm::vec3d::pos_x()});
+
+    auto faces = std::vector<PFace*>{};
+    CHECK_FALSE(Polyhedron3d::fromPlanes(planes, vm::bbox3d{8192.0}, faces));
+  }
+}
+
 TEST_CASE("PolyhedronTest.clipCubeWithHorizontalPlane", "[PolyhedronTest]") {
   const vm::vec3d p1(-64.0, -64.0, -64.0);
   const vm::vec3d p2(-64.0, -64.0, +64.0);
@@ -1029,6 +1156,71 @@ TEST_CASE("PolyhedronTest.subtractRhombusFromCuboid", "[PolyhedronTest]") {
   CHECK(result.size() == 0u);
 }
 
+TEST_CASE("PolyhedronTest.volume", "[PolyhedronTest]") {
+  CHECK(Polyhedron3d{}.volume() == 0.0);
+  CHECK(Polyhedron3d{vm::vec3d(0.0, 0.0, 0.0), vm::vec3d(1.0, 0.0, 0.0)}.volume() == 0.0);
+  CHECK(Polyhedron3d{vm::bbox3d{64.0}}.volume() == vm::approx(128.0 * 128.0 * 128.0));
+  CHECK(
+    Polyhedron3d{
+      vm::vec3d(1000.0, 1000.0, 1000.0), vm::vec3d(1006.0, 1000.0, 1000.0),
+      vm::vec3d(1000.0, 1006.0, 1000.0), vm::vec3d(1000.0, 1000.0, 1006.0)}
+      .volume() == vm::approx(36.0));
+}
+
+TEST_CASE("PolyhedronTest.mergeFragments", "[PolyhedronTest]") {
+  const auto left = Polyhedron3d{vm::bbox3d{vm::vec3d(-32, -32, -32), vm::vec3d(0, 32, 32)}};
+  const auto right = Polyhedron3d{vm::bbox3d{vm::vec3d(0, -32, -32), vm::vec3d(32, 32, 32)}};
+  const auto corner = Polyhedron3d{vm::bbox3d{vm::vec3d(32, -32, -32), vm::vec3d(64, 0, 32)}};
+  const auto distant = Polyhedron3d{vm::bbox3d{vm::vec3d(128, 128, 128), vm::vec3d(160, 160, 160)}};
+
+  const auto merged = Polyhedron3d::mergeFragments({left, corner, right, distant});
+
+  // left and right form a cube, but adding the corner would make it concave
+  REQUIRE(merged.size() == 3u);
+  CHECK(merged[0] == Polyhedron3d{vm::bbox3d{vm::vec3d(-32, -32, -32), vm::vec3d(32, 32, 32)}});
+  CHECK(merged[1] == corner);
+  CHECK(merged[2] == distant);
+}
+
+TEST_CASE("PolyhedronTest.mergeSubtractionFragments", "[PolyhedronTest]") {
+  // two adjacent boxes punched through the center of a cube, one after the other; the second
+  // subtraction splits the fragments left by the first one
+  const Polyhedron3d minuend(vm::bbox3d(32.0));
+  const auto subtrahends = std::vector<Polyhedron3d>{
+    Polyhedron3d{vm::bbox3d{vm::vec3d(-16, -16, -64), vm::vec3d(0, 16, 64)}},
+    Polyhedron3d{vm::bbox3d{vm::vec3d(0, -16, -64), vm::vec3d(16, 16, 64)}},
+  };
+
+  auto fragments = std::vector<Polyhedron3d>{minuend};
+  for (const auto& subtrahend : subtrahends) {
+    auto nextFragments = std::vector<Polyhedron3d>{};
+    for (const auto& fragment : fragments) {
+      for (auto& subFragment : fragment.subtract(subtrahend)) {
+        nextFragments.push_back(std::move(subFragment));
+      }
+    }
+    fragments = std::move(nextFragments);
+  }
+
+  const auto merged = Polyhedron3d::mergeFragments(fragments);
+
+  // subtracting the union of the subtrahends leaves four fragments
+  CHECK(fragments.size() > 4u);
+  CHECK(merged.size() == 4u);
+
+  const auto volume = [](const std::vector<Polyhedron3d>& polyhedra) {
+    auto result = 0.0;
+    for (const auto& polyhedron : polyhedra) {
+      result += polyhedron.volume();
+    }
+    return result;
+  };
+
+  // 64 * 64 * 64 - 32 * 32 * 64
+  CHECK(volume(fragments) == vm::approx(196608.0));
+  CHECK(volume(merged) == vm::approx(196608.0));
+}
+
 TEST_CASE("PolyhedronTest.intersection_empty_polyhedron", "[PolyhedronTest]") {
   const Polyhedron3d empty;
   const Polyhedron3d point{vm::vec3d(1.0, 0.0, 0.0)};
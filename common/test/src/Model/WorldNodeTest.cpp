@@ -39,6 +39,8 @@
 #include <vecmath/mat_ext.h>
 #include <vecmath/mat_io.h>
 
+#include <stdexcept>
+
 #include "Catch2.h"
 #include "TestUtils.h"
 
@@ -224,6 +226,84 @@ TEST_CASE("WorldNodeTest.nodeTreeUpdates") {
       nodeTree.findContainers(vm::vec3d{64, 0, 0}),
       Catch::UnorderedEquals(std::vector<Node*>{entityNode, brushNode, patchNode}));
   }
+
+  SECTION("Updating descendants in a batch updates them in node tree when the batch ends") {
+    groupNode->addChildren({entityNode, brushNode, patchNode});
+    worldNode.defaultLayer()->addChild(groupNode);
+
+    worldNode.beginNodeTreeBatch();
+    worldNode.beginNodeTreeBatch();
+
+    transformNode(*entityNode, vm::translation_matrix(vm::vec3d(64, 0, 0)), worldBounds);
+    transformNode(*brushNode, vm::translation_matrix(vm::vec3d(64, 0, 0)), worldBounds);
+    transformNode(*patchNode, vm::translation_matrix(vm::vec3d(64, 0, 0)), worldBounds);
+    transformNode(*patchNode, vm::translation_matrix(vm::vec3d(64, 0, 0)), worldBounds);
+
+    CHECK_THAT(
+      nodeTree.findContainers(vm::vec3d::zero()),
+      Catch::UnorderedEquals(std::vector<Node*>{entityNode, brushNode, patchNode}));
+
+    groupNode->removeChild(entityNode);
+    CHECK_FALSE(nodeTree.contains(entityNode));
+
+    worldNode.endNodeTreeBatch();
+    CHECK_THAT(
+      nodeTree.findContainers(vm::vec3d::zero()),
+      Catch::UnorderedEquals(std::vector<Node*>{brushNode, patchNode}));
+
+    worldNode.endNodeTreeBatch();
+    CHECK(nodeTree.contains(brushNode));
+    CHECK(nodeTree.contains(patchNode));
+    CHECK_THAT(
+      nodeTree.findContainers(vm::vec3d::zero()), Catch::UnorderedEquals(std::vector<Node*>{}));
+    CHECK_THAT(
+      nodeTree.findContainers(vm::vec3d{64, 0, 0}),
+      Catch::UnorderedEquals(std::vector<Node*>{brushNode}));
+    CHECK_THAT(
+      nodeTree.findContainers(vm::vec3d{128, 0, 0}),
+      Catch::UnorderedEquals(std::vector<Node*>{patchNode}));
+  }
+
+  SECTION("The node tree is updated when the batch ends") {
+    worldNode.defaultLayer()->addChildren({entityNode, brushNode});
+
+    auto nodeTreeBatch = WorldNode::NodeTreeBatch{worldNode};
+    transformNode(*brushNode, vm::translation_matrix(vm::vec3d(64, 0, 0)), worldBounds);
+
+    // querying the node tree does not apply the pending updates
+    CHECK_THAT(
+      worldNode.nodeTree().findContainers(vm::vec3d::zero()),
+      Catch::UnorderedEquals(std::vector<Node*>{entityNode, brushNode}));
+
+    nodeTreeBatch.end();
+
+    CHECK_THAT(
+      worldNode.nodeTree().findContainers(vm::vec3d::zero()),
+      Catch::UnorderedEquals(std::vector<Node*>{entityNode}));
+    CHECK_THAT(
+      worldNode.nodeTree().findContainers(vm::vec3d{64, 0, 0}),
+      Catch::UnorderedEquals(std::vector<Node*>{brushNode}));
+  }
+
+  SECTION("A batch guard ends the batch if an exception is thrown") {
+    worldNode.defaultLayer()->addChildren({entityNode, brushNode});
+
+    try {
+      const auto nodeTreeBatch = WorldNode::NodeTreeBatch{worldNode};
+      transformNode(*brushNode, vm::translation_matrix(vm::vec3d(64, 0, 0)), worldBounds);
+      throw std::runtime_error{"error"};
+    } catch (const std::runtime_error&) {
+    }
+
+    CHECK_THAT(
+      nodeTree.findContainers(vm::vec3d{64, 0, 0}),
+      Catch::UnorderedEquals(std::vector<Node*>{brushNode}));
+
+    transformNode(*entityNode, vm::translation_matrix(vm::vec3d(64, 0, 0)), worldBounds);
+    CHECK_THAT(
+      nodeTree.findContainers(vm::vec3d{64, 0, 0}),
+      Catch::UnorderedEquals(std::vector<Node*>{entityNode, brushNode}));
+  }
 }
 
 TEST_CASE("WorldNodeTest.rebuildNodeTree") {
@@ -28,6 +28,7 @@
 #include <memory>
 #include <optional>
 #include <thread>
+#include <tuple>
 #include <variant>
 
 #include "Catch2.h"
@@ -131,16 +132,19 @@ using TestCommandCall = std::variant<DoPerformDo, DoPerformUndo, DoCollateWith>;
 class TestCommand : public UndoableCommand {
 private:
   mutable std::vector<TestCommandCall> m_expectedCalls;
+  size_t m_reportedMemoryUsage;
 
 public:
   static const CommandType Type;
 
-  static std::unique_ptr<TestCommand> create(const std::string& name) {
-    return std::make_unique<TestCommand>(name);
+  static std::unique_ptr<TestCommand> create(
+    const std::string& name, const size_t reportedMemoryUsage = 0u) {
+    return std::make_unique<TestCommand>(name, reportedMemoryUsage);
   }
 
-  explicit TestCommand(const std::string& name)
-    : UndoableCommand(Type, name, false) {}
+  explicit TestCommand(const std::string& name, const size_t reportedMemoryUsage = 0u)
+    : UndoableCommand(Type, name, false)
+    , m_reportedMemoryUsage(reportedMemoryUsage) {}
 
   ~TestCommand() { CHECK(m_expectedCalls.empty()); }
 
@@ -170,6 +174,8 @@ private:
     return expectedCall.returnCanCollate;
   }
 
+  size_t doGetMemoryUsage() const override { return m_reportedMemoryUsage; }
+
 public:
   /**
    * Sets an expectation that doPerformDo() should be called.
@@ -605,5 +611,57 @@ TEST_CASE("CommandProcessorTest.collationInterval", "[CommandProcessorTest]") {
   REQUIRE(commandProcessor.undoCommandName() == commandName1);
   REQUIRE(commandProcessor.redoCommandName() == commandName2);
 }
+
+TEST_CASE("CommandProcessorTest.memoryBudget", "[CommandProcessorTest]") {
+  /*
+   * Execute three commands which together exceed the memory budget, then check that the oldest
+   * command is dropped and that the most recent command is kept even if it exceeds the budget on
+   * its own.
+   */
+
+  CommandProcessor commandProcessor(nullptr, std::chrono::milliseconds(1000), 250u);
+
+  auto droppedCommands = std::vector<std::tuple<size_t, size_t>>{};
+  const auto connection = commandProcessor.commandsDroppedNotifier.connect(
+    [&](const size_t count, const size_t memoryUsage) {
+      droppedCommands.emplace_back(count, memoryUsage);
+    });
+
+  const auto commandName1 = "test command 1";
+  auto command1 = TestCommand::create(commandName1, 100u);
+
+  const auto commandName2 = "test command 2";
+  auto command2 = TestCommand::create(commandName2, 100u);
+
+  const auto commandName3 = "test command 3";
+  auto command3 = TestCommand::create(commandName3, 100u);
+
+  command1->expectDo(true);
+  command1->expectCollate(command2.get(), false);
+  command2->expectDo(true);
+  command2->expectCollate(command3.get(), false);
+  command3->expectDo(true);
+  command3->expectUndo(true);
+
+  commandProcessor.executeAndStore(std::move(command1));
+  commandProcessor.executeAndStore(std::move(command2));
+  CHECK(commandProcessor.memoryUsage() == 200u);
+  CHECK(droppedCommands.empty());
+
+  commandProcessor.executeAndStore(std::move(command3));
+  CHECK(commandProcessor.memoryUsage() == 200u);
+  CHECK(droppedCommands == std::vector<std::tuple<size_t, size_t>>{{1u, 100u}});
+
+  CHECK(commandProcessor.undo()->success());
+  REQUIRE(commandProcessor.undoCommandName() == commandName2);
+  REQUIRE(commandProcessor.redoCommandName() == commandName3);
+  CHECK(commandProcessor.memoryUsage() == 200u);
+
+  commandProcessor.setMemoryBudget(50u);
+  CHECK(commandProcessor.memoryBudget() == 50u);
+  CHECK(commandProcessor.canUndo());
+  REQUIRE(commandProcessor.undoCommandName() == commandName2);
+  CHECK(droppedCommands.size() == 1u);
+}
 } // namespace View
 } // namespace TrenchBroom
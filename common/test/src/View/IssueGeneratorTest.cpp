@@ -21,14 +21,18 @@
 #include "MapDocumentTest.h"
 
 #include "Model/BrushNode.h"
+#include "Model/ConflictingTargetnameIssueGenerator.h"
 #include "Model/EmptyPropertyKeyIssueGenerator.h"
 #include "Model/EmptyPropertyValueIssueGenerator.h"
 #include "Model/EntityNode.h"
+#include "Model/EntityProperties.h"
 #include "Model/GroupNode.h"
 #include "Model/Issue.h"
 #include "Model/IssueQuickFix.h"
 #include "Model/LayerNode.h"
+#include "Model/ModelUtils.h"
 #include "Model/PatchNode.h"
+#include "Model/SoftMapBoundsIssueGenerator.h"
 #include "Model/WorldNode.h"
 
 #include <kdl/overload.h>
@@ -102,5 +106,89 @@ TEST_CASE_METHOD(MapDocumentTest, "IssueGeneratorTest.emptyProperty") {
 
   kdl::vec_clear_and_delete(issueGenerators);
 }
+
+TEST_CASE_METHOD(MapDocumentTest, "IssueGeneratorTest.validateIssuesInParallel") {
+  auto entityNodes = std::vector<Model::Node*>{};
+  for (size_t i = 0; i < 16; ++i) {
+    entityNodes.push_back(document->createPointEntity(m_pointEntityDef, vm::vec3::zero()));
+  }
+
+  document->deselectAll();
+  document->select(entityNodes);
+  document->setProperty("", "");
+
+  auto issueGenerators = std::vector<Model::IssueGenerator*>{
+    new Model::EmptyPropertyKeyIssueGenerator(), new Model::EmptyPropertyValueIssueGenerator()};
+
+  const auto nodes = Model::collectNodes({document->world()});
+  Model::Node::validateIssues(nodes, issueGenerators);
+
+  auto issues = std::vector<Model::Issue*>{};
+  for (auto* node : nodes) {
+    issues = kdl::vec_concat(std::move(issues), node->issues(issueGenerators));
+  }
+
+  REQUIRE(issues.size() == 2u * entityNodes.size());
+  for (size_t i = 0; i < entityNodes.size(); ++i) {
+    CHECK(issues[2u * i]->node() == entityNodes[i]);
+    CHECK(issues[2u * i]->type() == issueGenerators[0]->type());
+    CHECK(issues[2u * i + 1u]->node() == entityNodes[i]);
+    CHECK(issues[2u * i + 1u]->type() == issueGenerators[1]->type());
+  }
+
+  // issues are numbered in node order, regardless of the order in which they were generated
+  for (size_t i = 1; i < issues.size(); ++i) {
+    CHECK(issues[i - 1u]->seqId() < issues[i]->seqId());
+  }
+
+  kdl::vec_clear_and_delete(issueGenerators);
+}
+
+TEST_CASE_METHOD(MapDocumentTest, "IssueGeneratorTest.conflictingTargetnameInvalidatesNamesakes") {
+  auto* entityNode1 = document->createPointEntity(m_pointEntityDef, vm::vec3::zero());
+  auto* entityNode2 = document->createPointEntity(m_pointEntityDef, vm::vec3::zero());
+
+  document->deselectAll();
+  document->select(entityNode1);
+  document->setProperty(Model::EntityPropertyKeys::Targetname, "name");
+
+  auto issueGenerators =
+    std::vector<Model::IssueGenerator*>{new Model::ConflictingTargetnameIssueGenerator()};
+  CHECK(entityNode1->issues(issueGenerators).empty());
+
+  // only the second entity changes, but the first entity's issues must be updated, too
+  document->deselectAll();
+  document->select(entityNode2);
+  document->setProperty(Model::EntityPropertyKeys::Targetname, "name");
+
+  CHECK(entityNode1->issues(issueGenerators).size() == 1u);
+  CHECK(entityNode2->issues(issueGenerators).size() == 1u);
+
+  document->removeProperty(Model::EntityPropertyKeys::Targetname);
+
+  CHECK(entityNode1->issues(issueGenerators).empty());
+  CHECK(entityNode2->issues(issueGenerators).empty());
+
+  kdl::vec_clear_and_delete(issueGenerators);
+}
+TEST_CASE_METHOD(MapDocumentTest, "IssueGeneratorTest.softMapBounds") {
+  // the test game's soft map bounds are an empty box at the origin
+  auto* entityNode1 = document->createPointEntity(m_pointEntityDef, vm::vec3::zero());
+  auto* entityNode2 = document->createPointEntity(m_pointEntityDef, vm::vec3(64, 0, 0));
+
+  auto issueGenerators = std::vector<Model::IssueGenerator*>{
+    new Model::SoftMapBoundsIssueGenerator(game, document->world())};
+
+  SECTION("Nodes validated in parallel") {
+    Model::Node::validateIssues({entityNode1, entityNode2}, issueGenerators);
+  }
+
+  SECTION("Nodes validated one by one") {}
+
+  CHECK(entityNode1->issues(issueGenerators).size() == 1u);
+  CHECK(entityNode2->issues(issueGenerators).size() == 1u);
+
+  kdl::vec_clear_and_delete(issueGenerators);
+}
 } // namespace View
 } // namespace TrenchBroom
@@ -0,0 +1,85 @@
+/*
+ Copyright (C) 2021 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "View/MoveObjectsTool.h"
+
+#include "Model/BrushNode.h"
+#include "View/InputState.h"
+#include "View/MapDocument.h"
+
+#include <vecmath/bbox.h>
+#include <vecmath/bbox_io.h>
+#include <vecmath/mat.h>
+#include <vecmath/mat_ext.h>
+#include <vecmath/mat_io.h>
+#include <vecmath/vec.h>
+
+#include "MapDocumentTest.h"
+#include "TestUtils.h"
+
+#include "Catch2.h"
+
+namespace TrenchBroom {
+namespace View {
+TEST_CASE_METHOD(MapDocumentTest, "MoveObjectsToolTest.translateWhenMoveEnds") {
+  auto* brushNode = createBrushNode();
+  addNode(*document, document->parentForNodes(), brushNode);
+  document->select(brushNode);
+
+  const auto originalBounds = brushNode->logicalBounds();
+
+  auto commandCount = size_t(0);
+  const auto connection = document->commandDoneNotifier.connect([&](auto*) {
+    ++commandCount;
+  });
+
+  auto tool = MoveObjectsTool{document};
+  const auto inputState = InputState{};
+
+  REQUIRE(tool.startMove(inputState));
+  REQUIRE(tool.move(inputState, vm::vec3{16, 0, 0}) == MoveObjectsTool::MR_Continue);
+  REQUIRE(tool.move(inputState, vm::vec3{0, 16, 0}) == MoveObjectsTool::MR_Continue);
+
+  // the document is not changed while moving
+  CHECK(brushNode->logicalBounds() == originalBounds);
+  CHECK(commandCount == 0u);
+  CHECK(tool.previewTransformation() == vm::translation_matrix(vm::vec3{16, 16, 0}));
+
+  SECTION("Ending the move translates the objects once") {
+    tool.endMove(inputState);
+
+    CHECK(brushNode->logicalBounds() == originalBounds.translate(vm::vec3{16, 16, 0}));
+    CHECK(commandCount == 1u);
+    CHECK(tool.previewTransformation() == vm::mat4x4::identity());
+
+    document->undoCommand();
+    CHECK(brushNode->logicalBounds() == originalBounds);
+  }
+
+  SECTION("Cancelling the move leaves the objects untouched") {
+    tool.cancelMove();
+
+    CHECK(brushNode->logicalBounds() == originalBounds);
+    CHECK(commandCount == 0u);
+    CHECK(tool.previewTransformation() == vm::mat4x4::identity());
+  }
+}
+} // namespace View
+} // namespace TrenchBroom
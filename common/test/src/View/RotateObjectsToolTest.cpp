@@ -0,0 +1,100 @@
+/*
+ Copyright (C) 2021 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "View/RotateObjectsTool.h"
+
+#include "Model/BrushNode.h"
+#include "View/MapDocument.h"
+
+#include <vecmath/approx.h>
+#include <vecmath/bbox.h>
+#include <vecmath/bbox_io.h>
+#include <vecmath/mat.h>
+#include <vecmath/mat_ext.h>
+#include <vecmath/mat_io.h>
+#include <vecmath/scalar.h>
+#include <vecmath/vec.h>
+#include <vecmath/vec_io.h>
+
+#include <QStackedLayout>
+#include <QWidget>
+
+#include "MapDocumentTest.h"
+#include "TestUtils.h"
+
+#include "Catch2.h"
+
+namespace TrenchBroom {
+namespace View {
+TEST_CASE_METHOD(MapDocumentTest, "RotateObjectsToolTest.rotateWhenRotationIsCommitted") {
+  auto* brushNode = createBrushNode();
+  addNode(*document, document->parentForNodes(), brushNode);
+  document->select(brushNode);
+
+  // rotate around a point outside of the brush so that the rotation moves its bounds
+  const auto originalBounds = brushNode->logicalBounds();
+  const auto center = vm::vec3{64, 0, 0};
+  const auto rotation = vm::translation_matrix(center) *
+                        vm::rotation_matrix(vm::vec3::pos_z(), vm::to_radians(90.0)) *
+                        vm::translation_matrix(-center);
+
+  auto commandCount = size_t(0);
+  const auto connection = document->commandDoneNotifier.connect([&](auto*) {
+    ++commandCount;
+  });
+
+  auto tool = RotateObjectsTool{document};
+
+  // committing a rotation updates the tool page
+  auto widget = QWidget{};
+  tool.createPage(new QStackedLayout{&widget});
+
+  tool.beginRotation();
+  tool.applyRotation(center, vm::vec3::pos_z(), vm::to_radians(45.0));
+  tool.applyRotation(center, vm::vec3::pos_z(), vm::to_radians(90.0));
+
+  // the document is not changed while rotating
+  CHECK(brushNode->logicalBounds() == originalBounds);
+  CHECK(commandCount == 0u);
+  CHECK(tool.previewTransformation() == rotation);
+
+  SECTION("Committing the rotation rotates the objects once") {
+    tool.commitRotation();
+
+    const auto expectedBounds = originalBounds.transform(rotation);
+    CHECK(brushNode->logicalBounds().min == vm::approx(expectedBounds.min));
+    CHECK(brushNode->logicalBounds().max == vm::approx(expectedBounds.max));
+    CHECK(commandCount == 1u);
+    CHECK(tool.previewTransformation() == vm::mat4x4::identity());
+
+    document->undoCommand();
+    CHECK(brushNode->logicalBounds() == originalBounds);
+  }
+
+  SECTION("Cancelling the rotation leaves the objects untouched") {
+    tool.cancelRotation();
+
+    CHECK(brushNode->logicalBounds() == originalBounds);
+    CHECK(commandCount == 0u);
+    CHECK(tool.previewTransformation() == vm::mat4x4::identity());
+  }
+}
+} // namespace View
+} // namespace TrenchBroom
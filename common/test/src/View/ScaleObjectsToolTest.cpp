@@ -20,6 +20,20 @@
 
 #include "View/ScaleObjectsTool.h"
 
+#include "Model/BrushNode.h"
+#include "Model/Hit.h"
+#include "View/MapDocument.h"
+
+#include <vecmath/bbox.h>
+#include <vecmath/bbox_io.h>
+#include <vecmath/mat.h>
+#include <vecmath/mat_ext.h>
+#include <vecmath/mat_io.h>
+#include <vecmath/vec.h>
+
+#include "MapDocumentTest.h"
+#include "TestUtils.h"
+
 #include "Catch2.h"
 
 namespace TrenchBroom {
@@ -241,5 +255,50 @@ TEST_CASE("ScaleObjectsToolTest.moveBBoxEdge", "[ScaleObjectsToolTest]") {
       input1, BBoxEdge(vm::vec3(1, 1, 1), vm::vec3(1, -1, 1)), delta,
       ProportionalAxes(true, false, true), AnchorPos::Opposite) == exp1);
 }
+TEST_CASE_METHOD(MapDocumentTest, "ScaleObjectsToolTest.scaleWhenScaleIsCommitted") {
+  auto* brushNode = createBrushNode();
+  addNode(*document, document->parentForNodes(), brushNode);
+  document->select(brushNode);
+
+  const auto originalBounds = brushNode->logicalBounds();
+  const auto expectedBounds =
+    vm::bbox3{originalBounds.min, originalBounds.max + vm::vec3{32, 0, 0}};
+
+  auto commandCount = size_t(0);
+  const auto connection = document->commandDoneNotifier.connect([&](auto*) {
+    ++commandCount;
+  });
+
+  auto tool = ScaleObjectsTool{document};
+  tool.startScaleWithHit(Model::Hit{
+    ScaleObjectsTool::ScaleToolSideHitType, 0.0, originalBounds.max, BBoxSide{vm::vec3::pos_x()}});
+  tool.scaleByDelta(vm::vec3{16, 0, 0});
+  tool.scaleByDelta(vm::vec3{16, 0, 0});
+
+  // the document is not changed while scaling
+  CHECK(brushNode->logicalBounds() == originalBounds);
+  CHECK(commandCount == 0u);
+  CHECK(tool.bounds() == expectedBounds);
+  CHECK(tool.previewTransformation() == vm::scale_bbox_matrix(originalBounds, expectedBounds));
+
+  SECTION("Committing the scale scales the objects once") {
+    tool.commitScale();
+
+    CHECK(brushNode->logicalBounds() == expectedBounds);
+    CHECK(commandCount == 1u);
+    CHECK(tool.previewTransformation() == vm::mat4x4::identity());
+
+    document->undoCommand();
+    CHECK(brushNode->logicalBounds() == originalBounds);
+  }
+
+  SECTION("Cancelling the scale leaves the objects untouched") {
+    tool.cancelScale();
+
+    CHECK(brushNode->logicalBounds() == originalBounds);
+    CHECK(commandCount == 0u);
+    CHECK(tool.previewTransformation() == vm::mat4x4::identity());
+  }
+}
 } // namespace View
 } // namespace TrenchBroom
@@ -24,6 +24,8 @@
 #include "IO/Path.h"
 #include "Model/BezierPatch.h"
 #include "Model/Brush.h"
+#include "Model/BrushFace.h"
+#include "Model/BrushFaceAttributes.h"
 #include "Model/BrushNode.h"
 #include "Model/Entity.h"
 #include "Model/EntityNode.h"
@@ -74,6 +76,27 @@ TEST_CASE_METHOD(MapDocumentTest, "SwapNodeContentsTest.swapBrushes") {
   CHECK(brushNode->brush() == originalBrush);
 }
 
+TEST_CASE_METHOD(MapDocumentTest, "SwapNodeContentsTest.swapBrushFaceAttributes") {
+  auto* brushNode = createBrushNode();
+  addNode(*document, document->parentForNodes(), brushNode);
+
+  const auto originalBrush = brushNode->brush();
+  auto modifiedBrush = originalBrush;
+  modifiedBrush.face(0).setAttributes(Model::BrushFaceAttributes{"other"});
+
+  auto nodesToSwap = std::vector<std::pair<Model::Node*, Model::NodeContents>>{};
+  nodesToSwap.emplace_back(brushNode, modifiedBrush);
+
+  document->swapNodeContents("Swap Nodes", std::move(nodesToSwap), {});
+  CHECK(brushNode->brush() == modifiedBrush);
+
+  document->undoCommand();
+  CHECK(brushNode->brush() == originalBrush);
+
+  document->redoCommand();
+  CHECK(brushNode->brush() == modifiedBrush);
+}
+
 TEST_CASE_METHOD(MapDocumentTest, "SwapNodeContentsTest.swapPatches") {
   auto* patchNode = createPatchNode();
   addNode(*document, document->parentForNodes(), patchNode);
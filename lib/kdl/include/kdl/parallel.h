@@ -27,6 +27,7 @@
 #endif
 
 #include <atomic>
+#include <exception>
 #include <future> // for std::async
 #include <optional>
 #include <thread>
@@ -44,6 +45,9 @@ namespace kdl {
  * used, there is a relatively large overhead and this should only be used on large/slow to process
  * data sets.
  *
+ * If the lambda throws an exception, then the remaining indices may or may not be processed, and
+ * after all threads have finished, the first exception thrown is rethrown on the calling thread.
+ *
  * @tparam L type of lambda
  * @param count the maximum value (exclusive) to pass to lambda
  * @param lambda the lambda to run
@@ -74,8 +78,20 @@ template <class L> void parallel_for(const size_t count, L&& lambda) {
     });
   }
 
+  // wait for all threads before rethrowing, since they reference local variables
+  std::exception_ptr exception;
   for (size_t i = 0; i < numThreads; ++i) {
-    threads[i].wait();
+    try {
+      threads[i].get();
+    } catch (...) {
+      if (!exception) {
+        exception = std::current_exception();
+      }
+    }
+  }
+
+  if (exception) {
+    std::rethrow_exception(exception);
   }
 #endif
 }
@@ -91,6 +107,8 @@ template <class L> void parallel_for(const size_t count, L&& lambda) {
  * used, there is a relatively large overhead and this should only be used on large/slow to process
  * data sets.
  *
+ * If the lambda throws an exception, then the exception is rethrown on the calling thread.
+ *
  * @tparam T the type of the vector elements
  * @tparam L the type of the lambda to apply
  * @param input the vector
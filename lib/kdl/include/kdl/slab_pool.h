@@ -0,0 +1,235 @@
+/*
+ Copyright 2010-2019 Kristian Duske
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ associated documentation files (the "Software"), to deal in the Software without restriction,
+ including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or
+ substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace kdl {
+/**
+ * A pool of fixed size memory blocks for objects of type T.
+ *
+ * Blocks are carved out of larger slabs, each holding SlabSize blocks, so allocating and freeing
+ * objects does not require calls to the global allocator. Every thread keeps its own list of free
+ * blocks, which it refills from (and returns surplus blocks to) a shared list in batches of
+ * SlabSize blocks, so that the shared list is only locked once per batch.
+ *
+ * A block may be freed by a different thread than the one that allocated it. When a thread ends,
+ * its free blocks are returned to the shared list. Blocks that are allocated or freed while a
+ * thread ends, e.g. by the destructors of other thread local objects, are taken from or returned to
+ * the shared list directly. The slabs themselves are never released, so the memory used by the
+ * pool will not shrink below its peak usage.
+ *
+ * This is meant to be used to implement class specific operator new and delete for classes of
+ * which many small instances are allocated and freed.
+ */
+template <typename T, std::size_t SlabSize = 256> class slab_pool {
+private:
+  static_assert(SlabSize > 0, "slab size must not be zero");
+
+  union block {
+    block* next;
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  struct shared_state {
+    std::mutex mutex;
+    block* free = nullptr;
+    std::size_t free_count = 0;
+    std::vector<std::unique_ptr<block[]>> slabs;
+  };
+
+  struct local_state {
+    block* free = nullptr;
+    std::size_t free_count = 0;
+
+    ~local_state() {
+      local_state_destroyed() = true;
+      if (free != nullptr) {
+        give_back(*this, free_count);
+      }
+    }
+  };
+
+  static shared_state& shared() {
+    // intentionally leaked so that it outlives the thread local states and the objects in the pool
+    static auto* state = new shared_state{};
+    return *state;
+  }
+
+  /**
+   * Whether the calling thread's local state has been destroyed. This is trivially destructible, so
+   * unlike the local state itself, it can still be accessed while the thread ends.
+   */
+  static bool& local_state_destroyed() {
+    thread_local auto destroyed = false;
+    return destroyed;
+  }
+
+  /**
+   * Returns the calling thread's local state, or null if it has already been destroyed because the
+   * thread is ending.
+   */
+  static local_state* local() {
+    if (local_state_destroyed()) {
+      return nullptr;
+    }
+    thread_local auto state = local_state{};
+    return &state;
+  }
+
+  /**
+   * Adds a new slab to the shared free list. The shared state must be locked by the caller.
+   */
+  static void add_slab(shared_state& state) {
+    auto slab = std::make_unique<block[]>(SlabSize);
+    for (std::size_t i = 0; i < SlabSize - 1; ++i) {
+      slab[i].next = &slab[i + 1];
+    }
+    slab[SlabSize - 1].next = state.free;
+    state.free = &slab[0];
+    state.free_count += SlabSize;
+    state.slabs.push_back(std::move(slab));
+  }
+
+  /**
+   * Moves up to SlabSize blocks from the shared free list to the given local state, allocating a
+   * new slab if the shared free list is empty.
+   */
+  static void refill(local_state& local) {
+    auto& state = shared();
+    const auto lock = std::lock_guard<std::mutex>{state.mutex};
+
+    if (state.free == nullptr) {
+      add_slab(state);
+    }
+
+    block* first = state.free;
+    block* last = first;
+    std::size_t count = 1;
+    while (count < SlabSize && last->next != nullptr) {
+      last = last->next;
+      ++count;
+    }
+
+    state.free = last->next;
+    state.free_count -= count;
+    last->next = local.free;
+    local.free = first;
+    local.free_count += count;
+  }
+
+  /**
+   * Moves the given number of blocks from the given local state to the shared free list.
+   */
+  static void give_back(local_state& local, const std::size_t count) {
+    assert(count > 0 && count <= local.free_count);
+
+    block* first = local.free;
+    block* last = first;
+    for (std::size_t i = 1; i < count; ++i) {
+      last = last->next;
+    }
+    local.free = last->next;
+    local.free_count -= count;
+
+    auto& state = shared();
+    const auto lock = std::lock_guard<std::mutex>{state.mutex};
+    last->next = state.free;
+    state.free = first;
+    state.free_count += count;
+  }
+
+public:
+  /**
+   * Returns a block of memory that is suitably sized and aligned to hold an object of type T.
+   *
+   * @throw std::bad_alloc if a new slab must be allocated and the allocation fails
+   */
+  static void* allocate() {
+    auto* local_ptr = local();
+    if (local_ptr == nullptr) {
+      auto& state = shared();
+      const auto lock = std::lock_guard<std::mutex>{state.mutex};
+      if (state.free == nullptr) {
+        add_slab(state);
+      }
+
+      block* result = state.free;
+      state.free = result->next;
+      --state.free_count;
+      return result;
+    }
+
+    auto& state = *local_ptr;
+    if (state.free == nullptr) {
+      refill(state);
+    }
+
+    block* result = state.free;
+    state.free = result->next;
+    --state.free_count;
+    return result;
+  }
+
+  /**
+   * Returns the given block to the pool. The given pointer must have been obtained by calling
+   * allocate, and it must not be used after this function returns.
+   */
+  static void deallocate(void* ptr) noexcept {
+    if (ptr == nullptr) {
+      return;
+    }
+
+    block* b = static_cast<block*>(ptr);
+
+    auto* local_ptr = local();
+    if (local_ptr == nullptr) {
+      auto& state = shared();
+      const auto lock = std::lock_guard<std::mutex>{state.mutex};
+      b->next = state.free;
+      state.free = b;
+      ++state.free_count;
+      return;
+    }
+
+    auto& state = *local_ptr;
+    b->next = state.free;
+    state.free = b;
+    ++state.free_count;
+
+    // don't let threads that only free objects hoard blocks
+    if (state.free_count >= 2 * SlabSize) {
+      give_back(state, SlabSize);
+    }
+  }
+
+  /**
+   * Returns the number of slabs that have been allocated by this pool.
+   */
+  static std::size_t slab_count() {
+    auto& state = shared();
+    const auto lock = std::lock_guard<std::mutex>{state.mutex};
+    return state.slabs.size();
+  }
+};
+} // namespace kdl
@@ -0,0 +1,92 @@
+/*
+ Copyright 2010-2019 Kristian Duske
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ associated documentation files (the "Software"), to deal in the Software without restriction,
+ including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or
+ substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace kdl {
+/**
+ * A thread safe pool of immutable strings.
+ *
+ * Interning a string returns a reference to the pooled copy of that string. Equal strings are
+ * interned to the same object, so interned strings can be compared by address, and storing a
+ * pointer to an interned string instead of a copy saves memory if the same string is used many
+ * times. Interned strings are never removed from the pool, so the returned references remain valid
+ * for the lifetime of the pool. Consequently, the memory used by interned strings is only freed when
+ * the pool is destroyed, even if the strings are no longer used.
+ *
+ * Looking up a string takes a shared lock on the pool. Callers that look up the same strings
+ * frequently should keep the returned references instead of looking them up again.
+ */
+class string_interner {
+private:
+  mutable std::shared_mutex m_mutex;
+  // the keys are views of the owned strings
+  std::unordered_map<std::string_view, std::unique_ptr<const std::string>> m_strings;
+
+public:
+  /**
+   * Returns the pooled copy of the given string, adding it to the pool if necessary.
+   */
+  const std::string& intern(const std::string_view str) {
+    {
+      const auto lock = std::shared_lock<std::shared_mutex>{m_mutex};
+      const auto it = m_strings.find(str);
+      if (it != m_strings.end()) {
+        return *it->second;
+      }
+    }
+
+    const auto lock = std::unique_lock<std::shared_mutex>{m_mutex};
+    // another thread may have added the string in the meantime
+    const auto it = m_strings.find(str);
+    if (it != m_strings.end()) {
+      return *it->second;
+    }
+
+    auto pooled = std::make_unique<const std::string>(str);
+    const auto& result = *pooled;
+    m_strings.emplace(std::string_view{result}, std::move(pooled));
+    return result;
+  }
+
+  /**
+   * Returns the pooled copy of the given string, or null if the string is not in the pool. Does not
+   * add the given string to the pool.
+   */
+  const std::string* find(const std::string_view str) const {
+    const auto lock = std::shared_lock<std::shared_mutex>{m_mutex};
+    const auto it = m_strings.find(str);
+    return it != m_strings.end() ? it->second.get() : nullptr;
+  }
+
+  /**
+   * Returns the number of strings in the pool.
+   */
+  std::size_t size() const {
+    const auto lock = std::shared_lock<std::shared_mutex>{m_mutex};
+    return m_strings.size();
+  }
+};
+} // namespace kdl
@@ -23,6 +23,7 @@
 #include <atomic>
 #include <chrono>
 #include <iostream>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -90,6 +91,32 @@ TEST_CASE("transform_many", "[parallel_test]") {
         }));
 }
 
+TEST_CASE("exceptions are propagated", "[parallel_test]") {
+  auto processed = std::atomic<size_t>{0};
+  CHECK_THROWS_AS(
+    kdl::parallel_for(
+      100,
+      [&](const size_t i) {
+        if (i == 50) {
+          throw std::runtime_error{"error"};
+        }
+        std::atomic_fetch_add(&processed, static_cast<size_t>(1));
+      }),
+    std::runtime_error);
+  CHECK(static_cast<size_t>(processed) < 100u);
+
+  CHECK_THROWS_AS(
+    kdl::vec_parallel_transform(
+      std::vector<int>{1, 2, 3},
+      [](const int& v) {
+        if (v == 2) {
+          throw std::runtime_error{"error"};
+        }
+        return v;
+      }),
+    std::runtime_error);
+}
+
 TEST_CASE("overhead for small work batches", "[parallel_test]") {
   constexpr size_t OuterLoop = 1'000;
   constexpr size_t InnerLoop = 10;
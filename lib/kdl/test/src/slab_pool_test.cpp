@@ -0,0 +1,124 @@
+/*
+ Copyright 2010-2019 Kristian Duske
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ associated documentation files (the "Software"), to deal in the Software without restriction,
+ including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or
+ substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "kdl/parallel.h"
+#include "kdl/slab_pool.h"
+
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+namespace kdl {
+namespace {
+struct pooled {
+  std::uint64_t value;
+  double padding[3];
+};
+
+struct other_pooled {
+  std::uint64_t value;
+};
+
+struct late_pooled {
+  std::uint64_t value;
+};
+
+using late_pool = slab_pool<late_pooled, 4>;
+
+/**
+ * Frees its block when the thread ends. Since it is created before the pool's thread local state,
+ * it is destroyed after it.
+ */
+struct late_deallocator {
+  void* block = nullptr;
+
+  ~late_deallocator() { late_pool::deallocate(block); }
+};
+} // namespace
+
+TEST_CASE("slab_pool_test.allocate_and_deallocate", "[slab_pool_test]") {
+  using pool = slab_pool<pooled, 4>;
+
+  auto blocks = std::vector<void*>{};
+  for (std::size_t i = 0; i < 10; ++i) {
+    void* block = pool::allocate();
+    CHECK(reinterpret_cast<std::uintptr_t>(block) % alignof(pooled) == 0u);
+    blocks.push_back(block);
+  }
+
+  CHECK(std::set<void*>(blocks.begin(), blocks.end()).size() == blocks.size());
+  CHECK(pool::slab_count() == 3u);
+
+  for (void* block : blocks) {
+    pool::deallocate(block);
+  }
+
+  // freed blocks are reused
+  for (std::size_t i = 0; i < 10; ++i) {
+    blocks[i] = pool::allocate();
+  }
+  CHECK(pool::slab_count() == 3u);
+
+  for (void* block : blocks) {
+    pool::deallocate(block);
+  }
+  pool::deallocate(nullptr);
+}
+
+TEST_CASE("slab_pool_test.allocate_concurrently", "[slab_pool_test]") {
+  using pool = slab_pool<other_pooled, 16>;
+
+  auto blocks = std::vector<other_pooled*>(1000u);
+  parallel_for(blocks.size(), [&](const std::size_t i) {
+    blocks[i] = new (pool::allocate()) other_pooled{i};
+  });
+
+  for (std::size_t i = 0; i < blocks.size(); ++i) {
+    CHECK(blocks[i]->value == i);
+  }
+
+  // free the blocks on a different thread than the one that allocated them
+  parallel_for(blocks.size(), [&](const std::size_t i) {
+    pool::deallocate(blocks[blocks.size() - i - 1u]);
+  });
+}
+
+TEST_CASE("slab_pool_test.deallocate_while_thread_ends", "[slab_pool_test]") {
+  auto thread = std::thread{[]() {
+    thread_local auto deallocator = late_deallocator{};
+    deallocator.block = late_pool::allocate();
+  }};
+  thread.join();
+
+  // all blocks of the first slab were returned to the shared list, including the one that was freed
+  // after the thread's local state was destroyed
+  auto blocks = std::vector<void*>{};
+  for (std::size_t i = 0; i < 4; ++i) {
+    blocks.push_back(late_pool::allocate());
+  }
+  CHECK(late_pool::slab_count() == 1u);
+
+  for (void* block : blocks) {
+    late_pool::deallocate(block);
+  }
+}
+} // namespace kdl
@@ -0,0 +1,73 @@
+/*
+ Copyright 2010-2019 Kristian Duske
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ associated documentation files (the "Software"), to deal in the Software without restriction,
+ including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or
+ substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "kdl/parallel.h"
+#include "kdl/string_interner.h"
+
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+namespace kdl {
+TEST_CASE("string_interner_test.intern", "[string_interner_test]") {
+  auto interner = string_interner{};
+  CHECK(interner.size() == 0u);
+
+  const auto& a = interner.intern("a");
+  const auto& b = interner.intern(std::string{"b"});
+  CHECK(a == "a");
+  CHECK(b == "b");
+  CHECK(&a != &b);
+  CHECK(interner.size() == 2u);
+
+  CHECK(&interner.intern("a") == &a);
+  CHECK(&interner.intern(std::string_view{"b"}) == &b);
+  CHECK(interner.size() == 2u);
+
+  CHECK(interner.intern("") == "");
+  CHECK(interner.size() == 3u);
+}
+
+TEST_CASE("string_interner_test.find", "[string_interner_test]") {
+  auto interner = string_interner{};
+  CHECK(interner.find("a") == nullptr);
+
+  const auto& a = interner.intern("a");
+  CHECK(interner.find("a") == &a);
+  CHECK(interner.find(std::string{"a"}) == &a);
+  CHECK(interner.find("b") == nullptr);
+  CHECK(interner.size() == 1u);
+}
+
+TEST_CASE("string_interner_test.intern_concurrently", "[string_interner_test]") {
+  auto interner = string_interner{};
+
+  auto results = std::vector<const std::string*>(1000u);
+  parallel_for(results.size(), [&](const std::size_t i) {
+    results[i] = &interner.intern(std::to_string(i % 10u));
+  });
+
+  CHECK(interner.size() == 10u);
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    CHECK(*results[i] == std::to_string(i % 10u));
+    CHECK(results[i] == results[i % 10u]);
+  }
+}
+} // namespace kdl